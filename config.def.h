@@ -3,3 +3,7 @@
 #define MAX_INPUT_BUFFER 128
 #define MAX_OUTPUT_BUFFER 2048
 #define MAX_OUTPUT_FLUSH 1024
+/* milliseconds an escape waits to become a longer sequence */
+#define ESCAPE_TIMEOUT 25
+/* the longest paste delivered in one event, longer ones come in parts */
+#define MAX_PASTE (64 << 20)
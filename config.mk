@@ -2,8 +2,11 @@
 
 PREFIX = /usr/local
 
-CFLAGS  = -std=gnu99 -pedantic -Wall -Wextra
-LDFLAGS = -s
+# fix the terminal at build time, leaving out every other terminal
+#TERMINAL = xterm-256color
+
+CFLAGS  = -std=gnu99 -pedantic -Wall -Wextra -pthread
+LDFLAGS = -s -pthread
 
 CC  = cc
 AWK = awk
@@ -10,9 +10,15 @@
 #include <stdbool.h>
 
 #include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
+#include <pthread.h>
 #include <sys/ioctl.h>
 #include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <termios.h>
+#include <time.h>
 #include <unistd.h>
 
 #include "config.h"
@@ -27,18 +33,26 @@
 #define TERMINFO_ENUM
 #include "terminfo.h"
 #undef TERMINFO_ENUM
+#ifndef JX_TERMINAL
+/* the terminfo indices are only needed to load the terminfo database */
 #define TERMINFO_MAP
 #include "terminfo.h"
 #undef TERMINFO_MAP
+#endif
 #undef TERMINFO_NUMBER
 
 #define TERMINFO_STRING
 #define TERMINFO_ENUM
 #include "terminfo.h"
 #undef TERMINFO_ENUM
+#ifndef JX_TERMINAL
 #define TERMINFO_MAP
 #include "terminfo.h"
 #undef TERMINFO_MAP
+#define TERMINFO_EXTENDED
+#include "terminfo.h"
+#undef TERMINFO_EXTENDED
+#endif
 #undef TERMINFO_STRING
 
 #define TERMINFO_ESCAPE_CODES
@@ -71,24 +85,123 @@ static inline cfmakeraw(struct termios *termios)
 }
 #endif
 
-/* jinxes static state variables */
-static int tty;
-static bool initialised;
-static struct termios old_t;
-static int winch_fds[2];
-
-static const terminal_map *ttm;
-static const char *terminal;
-static const char *escape_code[TS_MAX];
-static unsigned short t_columns, t_lines;
-static int escape_code_len[TS_MAX];
-
-static char IN[MAX_INPUT_BUFFER];
-static int IN_index;
-static char OUT[MAX_OUTPUT_BUFFER];
-static int OUT_index;
+/* a composited cell, as shown or about to be shown on the terminal */
+typedef jx_cell cell;
+
+#ifndef JX_TERMINAL
+/* a terminal loaded from the terminfo database at run time, laid out so that
+ * it can be written to and mapped straight back from the cache */
+#define TERMINFO_CACHE_MAGIC "JXTI"
+#define TERMINFO_CACHE_VERSION 3
+
+typedef struct {
+	char magic[4];
+	uint16_t version, strings, numbers, unused;
+	/* the hash of the capabilities in terminfo.def.h */
+	uint32_t capabilities;
+	/* the compiled entry it was made from */
+	int64_t source_mtime, source_size;
+	unsigned int caps;
+	unsigned char caps_;
+	short capsn[TN_MAX];
+	unsigned int offset[TS_MAX];
+	unsigned short length[TS_MAX];
+	char table[];
+} terminfo_cache;
+#endif
 
-static jx_window *window_head, *window_tail;
+/* a copy of a window, used for frames where it is busy being drawn into */
+struct jx_snapshot_s {
+	int w;
+	cell cells[];
+};
+
+/* the longest colour and mode sequences kept expanded */
+#define MAX_COLOUR_LENGTH 24
+#define MAX_MODE_LENGTH 48
+
+/* everything belonging to one terminal, the terminfo tables are shared */
+struct jx_context_s {
+	int tty;
+	struct termios old_t;
+	int winch_fds[2];
+
+	const terminal_map *ttm;
+#ifndef JX_TERMINAL
+	/* a terminal from the terminfo database rather than compiled in */
+	terminal_map runtime;
+	terminfo_cache *cache;
+	size_t cache_size;
+	bool cache_mapped;
+	/* the escape codes are offsets and lengths into a table of strings */
+	const char *escape_table;
+	const unsigned int *escape_offset;
+	const unsigned short *escape_length;
+#endif
+	unsigned short t_columns, t_lines;
+
+	char IN[MAX_INPUT_BUFFER];
+	int IN_index;
+	char OUT[MAX_OUTPUT_BUFFER];
+	int OUT_index;
+	/* output a non-blocking terminal has not taken yet, sent first */
+	char *pending;
+	size_t pending_length, pending_size;
+
+	/* the window list, shared by drawing calls and the renderer and
+	 * exclusive to calls changing the structure or geometry */
+	pthread_rwlock_t lock;
+	jx_window *window_head, *window_tail;
+	/* destroyed windows keep their memory until the context closes, so
+	 * that a stale handle fails validation instead of touching freed
+	 * memory, and new windows reuse them */
+	jx_window *free_windows;
+	/* something was drawn or the screen was cleared since the last frame */
+	bool dirty, clear;
+	/* some window has children to lay out, and the passes so far */
+	bool layout;
+	unsigned int layout_pass;
+
+	/* render state, front is what the terminal shows and back is the
+	 * next frame */
+	cell *front, *back;
+	int front_w, front_h;
+	int out_x, out_y;
+	uint16_t out_fg, out_bg;
+	/* the terminal's foreground and background colour sequences */
+	char colour[2][8][MAX_COLOUR_LENGTH];
+	unsigned char colour_length[2][8];
+	int cursor_x, cursor_y;
+	bool cursor_visible, cursor_dirty;
+	/* the terminal reports the mouse and brackets pastes */
+	bool mouse, paste;
+	/* the sequences switching those modes and marking a paste */
+	char mouse_on[MAX_MODE_LENGTH], mouse_off[MAX_MODE_LENGTH];
+	const char *paste_on, *paste_off, *paste_start, *paste_end;
+	size_t paste_start_length, paste_end_length;
+
+	/* when the escape at the start of the input began waiting for the
+	 * rest of a sequence */
+	uint64_t escape_held;
+
+	/* pastes are read straight into their own buffer, input that arrived
+	 * after the end of the last one is left there and fed to IN */
+	char *paste_buffer;
+	size_t paste_size, paste_length, paste_searched, paste_delivered;
+	size_t spill_offset, spill_length;
+	bool pasting;
+
+	/* runtime statistics */
+	jx_stats stats;
+	jx_frame_hook frame_hook;
+	void *frame_hook_data;
+};
+
+/* the context used by calls that are not given one, per thread */
+static __thread jx_context *current;
+static __thread int last_error;
+/* the context of the controlling terminal, which receives SIGWINCH */
+static jx_context *winch_context;
 
 void debug_print(char* buffer, int l)
 {
@@ -116,20 +229,119 @@ void debug_print(char* buffer, int l)
 }
 
 #define SCLEN(x) x,sizeof(x)
-#define BUF_PUTC(b,x) b##[b##_index++] = x
-#define BUF_PUT(b,x,l) memcpy(b + b##_index, x, l), b##_index += l
-#define BUF_PUTE(b,x) BUF_PUT(b, escape_code[x], escape_code_len[x])
-#define BUF_RESET(b) b##_index = 0
-#define BUF_FLUSHIF(b) if (b##_index > MAX_##b##_FLUSH) \
-	write(tty, b, b##_index), b##_index = 0
-#define BUF_FLUSH(b) write(tty, b, b##_index), b##_index = 0
+#define MAX_OUT_FLUSH MAX_OUTPUT_FLUSH
+#define BUF_PUTC(c,b,x) (c)->b[(c)->b##_index++] = x
+#define BUF_PUT(c,b,x,l) memcpy((c)->b + (c)->b##_index, x, l), \
+	(c)->b##_index += l
+#ifdef JX_TERMINAL
+/* the terminal is fixed at build time, so its escape codes are literals */
+#define ESCAPE(c,x) (terminfo_strings + terminfo_offsets[0][x])
+#define ESCAPE_LENGTH(c,x) terminfo_lengths[0][x]
+#define BUF_PUTE(c,b,x) BUF_PUT(c, b, x##_STR, sizeof(x##_STR) - 1)
+#else
+#define ESCAPE(c,x) ((c)->escape_table + (c)->escape_offset[x])
+#define ESCAPE_LENGTH(c,x) ((c)->escape_length[x])
+#define BUF_PUTE(c,b,x) BUF_PUT(c, b, ESCAPE(c, x), ESCAPE_LENGTH(c, x))
+#endif
+#define BUF_RESET(c,b) (c)->b##_index = 0
+#define BUF_FLUSHIF(c,b) if ((c)->b##_index > MAX_##b##_FLUSH) \
+	buf_flush(c, (c)->b, &(c)->b##_index)
+#define BUF_FLUSH(c,b) buf_flush(c, (c)->b, &(c)->b##_index)
 #ifdef DEBUG
-#define BUF_DEBUG(b) debug_print(b, b##_index)
+#define BUF_DEBUG(c,b) debug_print((c)->b, (c)->b##_index)
 #else
-#define BUF_DEBUG(b)
+#define BUF_DEBUG(c,b)
 #endif
 
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+
+/* the flags that have jx_layout place a window */
+#define LAYOUT_FLAGS (JX_WF_ANCHOR_LEFT | JX_WF_ANCHOR_RIGHT | \
+	JX_WF_ANCHOR_TOP | JX_WF_ANCHOR_BOTTOM | JX_WF_AUTOSIZE | \
+	JX_WF_RELATIVE_X | JX_WF_RELATIVE_Y | JX_WF_RELATIVE_W | \
+	JX_WF_RELATIVE_H | JX_WF_DOCK_LEFT | JX_WF_DOCK_RIGHT | \
+	JX_WF_DOCK_TOP | JX_WF_DOCK_BOTTOM)
+/* attribute state that has not been sent yet */
+#define ATTR_UNKNOWN 0xffff
+
+/* monotonic time in nanoseconds */
+static inline uint64_t clock_ns()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/* count a latency in its log2 bucket */
+static inline void histogram_add(uint64_t *histogram, uint64_t ns)
+{
+	int bucket = 63 - __builtin_clzll(ns | 1);
+	histogram[MIN(bucket, JX_HISTOGRAM_BUCKETS - 1)]++;
+}
+
+/* write out as much as the terminal takes, carrying on after short writes,
+ * returning the bytes written */
+static size_t buf_write(jx_context *ctx, const char *b, size_t length)
+{
+	size_t done = 0;
+	while (done < length) {
+		ssize_t n = write(ctx->tty, b + done, length - done);
+		ctx->stats.write_calls++;
+		if (n < 0) {
+			if (errno == EINTR)
+				continue;
+			/* anything but a full non-blocking terminal is lost */
+			if (errno != EAGAIN && errno != EWOULDBLOCK)
+				done = length;
+			break;
+		}
+		if ((size_t)n < length - done)
+			ctx->stats.short_writes++;
+		ctx->stats.bytes_written += n;
+		done += n;
+	}
+	return done;
+}
+
+/* send the output queued for a non-blocking terminal */
+static void send_pending(jx_context *ctx)
+{
+	size_t n = buf_write(ctx, ctx->pending, ctx->pending_length);
+	ctx->pending_length -= n;
+	memmove(ctx->pending, ctx->pending + n, ctx->pending_length);
+}
+
+/* write out a buffer to the terminal, queueing what it does not take */
+static void buf_flush(jx_context *ctx, const char *b, int *index)
+{
+	uint64_t start = clock_ns();
+	size_t done = 0;
+	if (ctx->pending_length)
+		send_pending(ctx);
+	if (!ctx->pending_length)
+		done = buf_write(ctx, b, *index);
+	if (done < (size_t)*index) {
+		size_t n = *index - done;
+		if (ctx->pending_length + n > ctx->pending_size) {
+			size_t size = MAX(ctx->pending_size * 2, 4096);
+			while (size < ctx->pending_length + n)
+				size *= 2;
+			char *pending = realloc(ctx->pending, size);
+			if (pending) {
+				ctx->pending = pending;
+				ctx->pending_size = size;
+				ctx->stats.buffers_allocated++;
+			} else {
+				n = 0;
+			}
+		}
+		memcpy(ctx->pending + ctx->pending_length, b + done, n);
+		ctx->pending_length += n;
+	}
+	*index = 0;
+	histogram_add(ctx->stats.flush_ns, clock_ns() - start);
+}
 
 /* return string descriptions of errors */
 const char *jx_error(int e)
@@ -149,6 +361,8 @@ const char *jx_error(int e)
 			return "unsupported terminal";
 		case JX_ERR_PIPE_TRAP_ERROR:
 			return "pipe error";
+		case JX_ERR_HANGUP:
+			return "terminal hung up";
 		default:
 			return "unknown";
 	}
@@ -157,432 +371,2316 @@ const char *jx_error(int e)
 /* to handle the window change, pipe the size changes to the event handler */
 static void sigwinch_handler(int sig)
 {
+	jx_context *ctx = winch_context;
 	struct winsize size;
-	int ret = ioctl(tty, TIOCGWINSZ, &size);
-	write(winch_fds[1], &ret, sizeof(int));
-	write(winch_fds[1], &size.ws_row, sizeof(unsigned short));
-	write(winch_fds[1], &size.ws_col, sizeof(unsigned short));
+	if (!ctx)
+		return;
+	int ret = ioctl(ctx->tty, TIOCGWINSZ, &size);
+	write(ctx->winch_fds[1], &ret, sizeof(int));
+	write(ctx->winch_fds[1], &size.ws_row, sizeof(unsigned short));
+	write(ctx->winch_fds[1], &size.ws_col, sizeof(unsigned short));
 }
 
-/* initialise the terminal from environment, fall back to xterm-256color */
-static int init_term()
+#ifdef JX_TERMINAL
+/* only the terminal fixed at build time can be used */
+static int use_terminal(jx_context *ctx, const char *terminal)
 {
-	terminal = getenv("TERM");
-	if (!terminal)
-		terminal = "xterm-256color";
+	if (strcmp(terminal, TERMINAL_NAME))
+		return -1;
+	ctx->ttm = &fixed_terminal;
+	return 0;
+}
+
+static void release_terminfo(jx_context *ctx)
+{
+	(void)ctx;
+}
+#else
+#if TERMINAL_COUNT
+/* the hash terminfo.awk built the perfect hash of terminal names with */
+static unsigned int terminal_hash(const char *s, unsigned int d)
+{
+	uint64_t h = 0;
+	for (; *s; s++)
+		h = (h * (31 + d) + (unsigned char)*s) % 16777213;
+	return h;
+}
 
-	/* TODO: fall intelligently to similar terminal
-	 * names/terminfo database*/
+/* find a compiled in terminal and point a context at its escape codes */
+static int set_terminal(jx_context *ctx, const char *terminal)
+{
+	unsigned int d = terminal_displacement[
+		terminal_hash(terminal, 0) % TERMINAL_BUCKETS];
+	const terminal_map *t =
+		&terminals[terminal_hash(terminal, d) % TERMINAL_COUNT];
+	if (strcmp(t->name, terminal))
+		return -1;
+	ctx->ttm = t;
+	ctx->escape_table = terminfo_strings;
+	ctx->escape_offset = terminfo_offsets[t->esc];
+	ctx->escape_length = terminfo_lengths[t->esc];
+	return 0;
+}
+#else
+/* nothing is compiled in, every terminal comes from the terminfo database */
+static int set_terminal(jx_context *ctx, const char *terminal)
+{
+	(void)ctx;
+	(void)terminal;
+	return -1;
+}
+#endif
 
-	return jx_set_terminal(terminal);
+/* let go of a terminal loaded at run time */
+static void release_terminfo(jx_context *ctx)
+{
+	if (ctx->cache_mapped)
+		munmap(ctx->cache, ctx->cache_size);
+	else
+		free(ctx->cache);
+	ctx->cache = NULL;
+	ctx->cache_mapped = false;
 }
 
-/* check if terminal has capability */
-static bool has_bool(terminfo_boolean b)
+static inline int le16(const unsigned char *p)
 {
-	if (b >= 32) return (ttm->caps_ & (1 << (b - 32)));
-	else return (ttm->caps & (1 << b));
+	return (int16_t)(p[0] | p[1] << 8);
 }
 
-/* check if window pointer is valid */
-static int check_window(jx_window *w)
+static inline int32_t le32(const unsigned char *p)
 {
-	for (jx_window *a = window_head; a != window_tail; a = a->next)
-		if (w == a)
-			return JX_SUCCESS;
-	return JX_ERR_INVALID_WINDOW;
+	return (int32_t)((uint32_t)p[0] | (uint32_t)p[1] << 8 |
+	                 (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24);
 }
 
-/* initialise the library and sets up the terminal */
-int jx_initialise()
+/* look for a compiled terminfo entry in one directory of the database */
+static int find_terminfo_in(const char *dir, const char *name,
+		char *path, struct stat *st)
 {
-	if (!(tty = open("/dev/tty", O_RDWR)))
-		return JX_ERR_OPEN_TTY;
+	if (!dir || !*dir)
+		return -1;
+	snprintf(path, PATH_MAX, "%s/%c/%s", dir, name[0], name);
+	if (!stat(path, st))
+		return 0;
+	/* case insensitive file systems use the hex of the first letter */
+	snprintf(path, PATH_MAX, "%s/%02x/%s", dir, name[0], name);
+	return stat(path, st);
+}
 
-	if (init_term()) {
-		close(tty);
-		return JX_ERR_UNSUPPORTED_TERMINAL;
+/* look for a compiled terminfo entry, in the order ncurses does */
+static int find_terminfo(const char *name, char *path, struct stat *st)
+{
+	static const char *system_dirs[] = {
+		"/etc/terminfo", "/lib/terminfo", "/usr/share/terminfo",
+		"/usr/lib/terminfo", "/usr/share/lib/terminfo", NULL
+	};
+	char dir[PATH_MAX];
+	const char *env;
+
+	if (!find_terminfo_in(getenv("TERMINFO"), name, path, st))
+		return 0;
+	if ((env = getenv("HOME"))) {
+		snprintf(dir, sizeof(dir), "%s/.terminfo", env);
+		if (!find_terminfo_in(dir, name, path, st))
+			return 0;
+	}
+	if ((env = getenv("TERMINFO_DIRS"))) {
+		while (*env) {
+			size_t l = strcspn(env, ":");
+			snprintf(dir, sizeof(dir), "%.*s", (int)l, env);
+			if (!find_terminfo_in(dir, name, path, st))
+				return 0;
+			env += l + (env[l] == ':');
+		}
 	}
+	for (const char **d = system_dirs; *d; d++)
+		if (!find_terminfo_in(*d, name, path, st))
+			return 0;
+	return -1;
+}
 
-	if (pipe(winch_fds)) {
-		close(tty);
-		return JX_ERR_PIPE_TRAP_ERROR;
+/* find the extended string capabilities jinxes knows by name, in the section
+ * that may follow the standard ones at off (see term(5)) */
+static void parse_extended(const unsigned char *d, size_t n, size_t off,
+		int numsize, const char **str, size_t *len)
+{
+	/* it starts on an even byte */
+	off += off & 1;
+	if (off + 10 > n)
+		return;
+	int bools = le16(d + off), nums = le16(d + off + 2);
+	int strs = le16(d + off + 4), table = le16(d + off + 8);
+	if (bools < 0 || nums < 0 || strs < 0 || table < 0)
+		return;
+	off += 10 + bools;
+	off += off & 1;
+	off += nums * numsize;
+	const unsigned char *str_offsets = d + off;
+	/* every capability has a name, after the offsets of the strings */
+	const unsigned char *name_offsets = str_offsets + strs * 2;
+	off += (strs + bools + nums + strs) * 2;
+	if (off + table > n)
+		return;
+	const char *str_table = (const char *)d + off;
+
+	/* the names are relative to the end of the strings */
+	int base = 0;
+	for (int i = 0; i < strs; i++) {
+		int o = le16(str_offsets + 2 * i);
+		if (o >= 0 && o < table)
+			base = MAX(base, o + (int)strnlen(str_table + o,
+			                                  table - o) + 1);
 	}
+	for (int i = 0; i < strs; i++) {
+		int o = le16(str_offsets + 2 * i);
+		int k = le16(name_offsets + 2 * (bools + nums + i));
+		if (o < 0 || o >= table || k < 0 || k >= table - base)
+			continue;
+		const char *name = str_table + base + k;
+		if (strnlen(name, table - base - k) == (size_t)(table - base - k))
+			continue;
+		for (int j = 0; j < TS_MAX; j++) {
+			if (!terminfo_map_extended[j] ||
+			    strcmp(name, terminfo_map_extended[j]))
+				continue;
+			str[j] = str_table + o;
+			len[j] = strnlen(str[j], table - o);
+		}
+	}
+}
 
-	struct sigaction sa;
-	sigemptyset(&sa.sa_mask);
-	sa.sa_flags = 0;
-	sa.sa_handler = sigwinch_handler;
-	sigaction(SIGWINCH, &sa, 0);
+/* convert a compiled terminfo entry (see term(5)) into the cache layout */
+static terminfo_cache *parse_terminfo(const unsigned char *d, size_t n,
+		size_t *size)
+{
+	if (n < 12)
+		return NULL;
+	/* the newer format has 32 bit numbers */
+	int magic = le16(d), numsize = magic == 01036 ? 4 : 2;
+	if (magic != 0432 && magic != 01036)
+		return NULL;
+	int names = le16(d + 2), bools = le16(d + 4), nums = le16(d + 6);
+	int strs = le16(d + 8), table = le16(d + 10);
+	if (names < 0 || bools < 0 || nums < 0 || strs < 0 || table < 0)
+		return NULL;
 
-	if (tcgetattr(tty, &old_t))
-		return JX_ERR_TERMIOS;
+	size_t off = 12 + names;
+	const unsigned char *bool_caps = d + off;
+	off += bools;
+	/* numbers start on an even byte */
+	off += off & 1;
+	const unsigned char *num_caps = d + off;
+	off += nums * numsize;
+	const unsigned char *str_offsets = d + off;
+	off += strs * 2;
+	const char *str_table = (const char *)d + off;
+	off += table;
+	if (off > n)
+		return NULL;
 
-	struct termios t = old_t;
-	cfmakeraw(&t);
-	t.c_cc[VMIN] = 0;
-	t.c_cc[VTIME] = 0;
-	if (tcsetattr(tty, TCSAFLUSH, &t))
-		return JX_ERR_TERMIOS;
+	const char *str[TS_MAX] = { NULL };
+	size_t len[TS_MAX];
+	for (int i = 0; i < TS_MAX; i++) {
+		int s = terminfo_map_string[i];
+		int o = s >= 0 && s < strs ? le16(str_offsets + 2 * s) : -1;
+		if (o < 0 || o >= table)
+			continue;
+		str[i] = str_table + o;
+		len[i] = strnlen(str[i], table - o);
+	}
+	parse_extended(d, n, off, numsize, str, len);
+
+	/* the table starts with the empty string for missing capabilities */
+	*size = sizeof(terminfo_cache) + 1;
+	for (int i = 0; i < TS_MAX; i++)
+		if (str[i])
+			*size += len[i] + 1;
+
+	terminfo_cache *c = calloc(*size, 1);
+	memcpy(c->magic, TERMINFO_CACHE_MAGIC, 4);
+	c->version = TERMINFO_CACHE_VERSION;
+	c->capabilities = TERMINFO_CAPABILITIES;
+	c->strings = TS_MAX;
+	c->numbers = TN_MAX;
+	for (int i = 0; i < bools && i < 40; i++) {
+		if (bool_caps[i] != 1)
+			continue;
+		if (i < 32)
+			c->caps |= 1u << i;
+		else
+			c->caps_ |= 1u << (i - 32);
+	}
+	for (int i = 0; i < TN_MAX; i++) {
+		int s = terminfo_map_number[i];
+		int32_t v = s >= nums ? -1 : numsize == 4 ?
+			le32(num_caps + 4 * s) : le16(num_caps + 2 * s);
+		c->capsn[i] = v < 0 ? 0 : MIN(v, SHRT_MAX);
+	}
+	size_t t = 1;
+	for (int i = 0; i < TS_MAX; i++) {
+		if (!str[i])
+			continue;
+		memcpy(c->table + t, str[i], len[i]);
+		c->offset[i] = t;
+		c->length[i] = len[i];
+		t += len[i] + 1;
+	}
+	return c;
+}
 
-	OUT_index = 0; IN_index = 0;
+/* where the converted entry of a terminal is cached */
+static int terminfo_cache_path(const char *name, char *path)
+{
+	const char *xdg = getenv("XDG_CACHE_HOME"), *home = getenv("HOME");
+	if (xdg && *xdg)
+		snprintf(path, PATH_MAX, "%s/jinxes", xdg);
+	else if (home && *home)
+		snprintf(path, PATH_MAX, "%s/.cache/jinxes", home);
+	else
+		return -1;
+	size_t l = strlen(path);
+	snprintf(path + l, PATH_MAX - l, "/%s", name);
+	return 0;
+}
 
-	BUF_PUTE(OUT, TS_CLEAR_SCREEN);
-	BUF_PUTE(OUT, TS_ENTER_CA_MODE);
-	BUF_PUTE(OUT, TS_KEYPAD_XMIT);
-	BUF_PUTE(OUT, TS_CURSOR_INVISIBLE);
-	BUF_DEBUG(OUT);
-	BUF_FLUSH(OUT);
+/* check that every escape code of a cached entry lies within it */
+static bool terminfo_cache_bounded(const terminfo_cache *c, size_t size)
+{
+	size_t table = size - sizeof(terminfo_cache);
+	for (int i = 0; i < TS_MAX; i++) {
+		size_t end = (size_t)c->offset[i] + c->length[i];
+		if (end >= table || c->table[end])
+			return false;
+	}
+	return true;
+}
 
-	/* TODO: check if this is needed */
-	int ret;
-	sigwinch_handler(0);
-	read(winch_fds[0], &ret, sizeof(int));
-	read(winch_fds[0], &t_columns, sizeof(unsigned short));
-	read(winch_fds[0], &t_lines, sizeof(unsigned short));
+/* map a cached entry, if it is still the one made from the database */
+static terminfo_cache *map_terminfo_cache(const char *path,
+		const struct stat *source, size_t *size)
+{
+	struct stat st;
+	int fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return NULL;
+	terminfo_cache *c = NULL;
+	if (!fstat(fd, &st) && (size_t)st.st_size > sizeof(terminfo_cache)) {
+		c = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (c == MAP_FAILED) {
+			c = NULL;
+		} else if (memcmp(c->magic, TERMINFO_CACHE_MAGIC, 4) ||
+		    c->version != TERMINFO_CACHE_VERSION ||
+		    c->capabilities != TERMINFO_CAPABILITIES ||
+		    c->strings != TS_MAX || c->numbers != TN_MAX ||
+		    c->source_mtime != (int64_t)source->st_mtime ||
+		    c->source_size != (int64_t)source->st_size ||
+		    !terminfo_cache_bounded(c, st.st_size)) {
+			munmap(c, st.st_size);
+			c = NULL;
+		}
+		*size = st.st_size;
+	}
+	close(fd);
+	return c;
+}
 
-	if (ret == -1)
-		return JX_ERR_IOCTL;
+/* store a converted entry, replacing any stale one atomically */
+static void write_terminfo_cache(const char *path, const terminfo_cache *c,
+		size_t size)
+{
+	char tmp[PATH_MAX + 16];
+	/* make the cache directory and its parent */
+	snprintf(tmp, sizeof(tmp), "%s", path);
+	for (char *p = strchr(tmp + 1, '/'); p; p = strchr(p + 1, '/')) {
+		*p = '\0';
+		mkdir(tmp, 0755);
+		*p = '/';
+	}
+	snprintf(tmp, sizeof(tmp), "%s.%d", path, (int)getpid());
+	int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return;
+	bool ok = write(fd, c, size) == (ssize_t)size;
+	close(fd);
+	if (!ok || rename(tmp, path))
+		unlink(tmp);
+}
 
-	/* create first window for the screen */
-	window_head = window_tail = calloc(sizeof(jx_window), 1);
-	window_head->w = t_columns;
-	window_head->h = t_lines;
-	window_head->flags = JX_WF_AUTOSIZE | JX_WF_AUTOSIZE;
+/* load a terminal from the terminfo database, through the cache */
+static int load_terminfo(jx_context *ctx, const char *terminal)
+{
+	char path[PATH_MAX], cache_path[PATH_MAX];
+	struct stat source;
+	terminfo_cache *c = NULL;
+	size_t size = 0;
+	bool mapped = true;
+
+	/* names are file names in the database */
+	if (!*terminal || terminal[0] == '.' || strchr(terminal, '/'))
+		return -1;
+	if (find_terminfo(terminal, path, &source))
+		return -1;
+
+	bool cached = !terminfo_cache_path(terminal, cache_path);
+	if (cached)
+		c = map_terminfo_cache(cache_path, &source, &size);
+	if (!c) {
+		int fd = open(path, O_RDONLY);
+		if (fd < 0)
+			return -1;
+		unsigned char *d = malloc(source.st_size);
+		bool ok = read(fd, d, source.st_size) == source.st_size;
+		close(fd);
+		if (ok)
+			c = parse_terminfo(d, source.st_size, &size);
+		free(d);
+		if (!c)
+			return -1;
+		c->source_mtime = source.st_mtime;
+		c->source_size = source.st_size;
+		if (cached)
+			write_terminfo_cache(cache_path, c, size);
+		mapped = false;
+	}
 
-	initialised = true;
+	release_terminfo(ctx);
+	ctx->cache = c;
+	ctx->cache_size = size;
+	ctx->cache_mapped = mapped;
+	ctx->runtime.caps = c->caps;
+	ctx->runtime.caps_ = c->caps_;
+	memcpy(ctx->runtime.capsn, c->capsn, sizeof(c->capsn));
+	ctx->ttm = &ctx->runtime;
+	ctx->escape_table = c->table;
+	ctx->escape_offset = c->offset;
+	ctx->escape_length = c->length;
+	return 0;
+}
 
-	return JX_SUCCESS;
+/* select a terminal, compiled in or from the terminfo database */
+static int use_terminal(jx_context *ctx, const char *terminal)
+{
+	if (!set_terminal(ctx, terminal)) {
+		release_terminfo(ctx);
+		return 0;
+	}
+	return load_terminfo(ctx, terminal);
 }
+#endif
 
-/* finalise everything */
-void jx_terminate()
+/* skip the rest of a branch of a parameterised string, to just past the %e
+ * that starts the other branch if to_else is set, or else past its %; */
+static const char *skip_branch(const char *s, const char *end, bool to_else)
 {
-	if (initialised) {
-		/* clear the screen and restore mode */
-		BUF_PUTE(OUT, TS_CURSOR_NORMAL);
-		BUF_PUTE(OUT, TS_EXIT_ATTRIBUTE_MODE);
-		BUF_PUTE(OUT, TS_CLEAR_SCREEN);
-		BUF_PUTE(OUT, TS_KEYPAD_LOCAL);
-		BUF_PUTE(OUT, TS_EXIT_CA_MODE);
-		BUF_FLUSH(OUT);
-		/* restore terminal settings */
-		tcsetattr(tty, TCSAFLUSH, &old_t);
-		close(tty);
-		close(winch_fds[0]);
-		close(winch_fds[1]);
-		initialised = false;
+	int depth = 0;
+	while (s < end) {
+		if (*s++ != '%' || s == end)
+			continue;
+		char c = *s++;
+		if (c == '\'')
+			s += 2;
+		else if (c == '?')
+			depth++;
+		else if (c == ';' && !depth--)
+			break;
+		else if (c == 'e' && to_else && !depth)
+			break;
 	}
+	return s;
 }
 
-/* set the terminal */
-int jx_set_terminal(const char *terminal)
+/* expand a parameterised capability (see terminfo(5)) into o, returning its
+ * length or -1 if the terminal lacks it */
+static int expand_param(jx_context *ctx, terminfo_string cap, int p1, int p2,
+		char *o, int size)
 {
-	terminal_map *t = terminals;
-	short term[sizeof(terminals)/sizeof(terminal_map)];
-	unsigned short escode[TS_MAX];
-	int i = 0;
-	/* find the terminal */
-	for (; t->name; t++) {
-		if (strcmp(t->name, terminal)) continue;
-		/* save the target terminal */
-		ttm = t;
-		/* find the parent terminal */
-		while (t->parent != -1) {
-			term[i++] = t - terminals;
-			t = terminals + t->parent;
-		}
-		/* copy escape codes from terminal */
-		memcpy(escode, t->esc, sizeof(escode));
-		/* modify with each successive variation */
-		for (i = i-1; i >= 0; i--) {
-			const terminal_variant *tv = terminals[term[i]].esc;
-			for (; tv->location != -1; tv++)
-				escode[tv->location] = tv->esc;
-		}
-		/* store pointers to the escape code strings */
-		for (i = 0; i < TS_MAX; i++) {
-			if (escode[i] & (1 << 14))
-				escape_code[i] =
-					terminfo_short8_esctable[escode[i] & ~(1<<14)];
-			else if (escode[i] & (1 << 15))
-				escape_code[i] =
-					terminfo_short12_esctable[escode[i] & ~(1<<15)];
+	const char *s = ESCAPE(ctx, cap), *end = s + ESCAPE_LENGTH(ctx, cap);
+	int param[9] = { p1, p2 }, vars[52] = { 0 }, stack[16], sp = 0, n = 0;
+	(void)ctx;
+	if (s == end)
+		return -1;
+
+#define PUT(x) (n < size ? o[n++] = (x) : 0)
+#define PUSH(v) (sp < 16 ? stack[sp++] = (v) : 0)
+#define POP() (sp ? stack[--sp] : 0)
+	while (s < end) {
+		/* padding is for hardware terminals */
+		if (s[0] == '$' && s + 1 < end && s[1] == '<') {
+			while (s < end && *s++ != '>');
+			continue;
+		}
+		if (*s != '%' || ++s == end) {
+			PUT(*s++);
+			continue;
+		}
+		char d[12];
+		int a, b, c = *s++;
+		switch (c) {
+		case '%':
+			PUT('%');
+			break;
+		case 'c':
+			PUT(POP());
+			break;
+		case 'd':
+			a = POP();
+			if (a < 0)
+				PUT('-');
+			b = 0;
+			do d[b++] = '0' + abs(a % 10); while (a /= 10);
+			while (b)
+				PUT(d[--b]);
+			break;
+		case 'p':
+			if (s < end && *s >= '1' && *s <= '9')
+				PUSH(param[*s - '1']);
+			s++;
+			break;
+		case 'P':
+		case 'g':
+			a = s < end ? *s++ : 0;
+			a = a >= 'a' && a <= 'z' ? a - 'a' :
+			    a >= 'A' && a <= 'Z' ? a - 'A' + 26 : -1;
+			if (a < 0)
+				break;
+			if (c == 'P')
+				vars[a] = POP();
 			else
-				escape_code[i] =
-					terminfo_long_esctable[escode[i]];
-			escape_code_len[i] = strlen(escape_code[i]);
+				PUSH(vars[a]);
+			break;
+		case '\'':
+			PUSH(s < end ? *s : 0);
+			s += 2;
+			break;
+		case '{':
+			for (a = 0; s < end && *s >= '0' && *s <= '9'; s++)
+				a = a * 10 + *s - '0';
+			PUSH(a);
+			s++;
+			break;
+		case 'i':
+			param[0]++;
+			param[1]++;
+			break;
+		case '!':
+			a = POP();
+			PUSH(!a);
+			break;
+		case '~':
+			a = POP();
+			PUSH(~a);
+			break;
+		case 't':
+			if (!POP())
+				s = skip_branch(s, end, true);
+			break;
+		case 'e':
+			s = skip_branch(s, end, false);
+			break;
+		case '?':
+		case ';':
+			break;
+		default:
+			b = POP();
+			a = POP();
+			switch (c) {
+			case '+': PUSH(a + b); break;
+			case '-': PUSH(a - b); break;
+			case '*': PUSH(a * b); break;
+			case '/': PUSH(b ? a / b : 0); break;
+			case 'm': PUSH(b ? a % b : 0); break;
+			case '&': PUSH(a & b); break;
+			case '|': PUSH(a | b); break;
+			case '^': PUSH(a ^ b); break;
+			case '=': PUSH(a == b); break;
+			case '<': PUSH(a < b); break;
+			case '>': PUSH(a > b); break;
+			case 'A': PUSH(a && b); break;
+			case 'O': PUSH(a || b); break;
+			}
 		}
-		return 0;
 	}
-	return -1;
+#undef PUT
+#undef PUSH
+#undef POP
+	return n;
 }
 
-/* get the top level main screen window */
-jx_window *jx_screen()
+/* the colours go out with nearly every cell, so expand them once, ansi
+ * terminals lacking set_a_foreground and set_a_background */
+static void expand_colours(jx_context *ctx)
 {
-	return window_head;
+	for (int i = 0; i < 8; i++) {
+		char *f = ctx->colour[0][i], *b = ctx->colour[1][i];
+		int l = expand_param(ctx, TS_SET_A_FOREGROUND, i, 0,
+		                     f, MAX_COLOUR_LENGTH);
+		ctx->colour_length[0][i] = l >= 0 ? l :
+			snprintf(f, MAX_COLOUR_LENGTH, "\033[3%dm", i);
+		l = expand_param(ctx, TS_SET_A_BACKGROUND, i, 0,
+		                 b, MAX_COLOUR_LENGTH);
+		ctx->colour_length[1][i] = l >= 0 ? l :
+			snprintf(b, MAX_COLOUR_LENGTH, "\033[4%dm", i);
+	}
 }
 
-/* create a window to edit */
-jx_window *jx_create_window(jx_window *parent, int x, int y, int w, int h,
-		int flags)
+/* xterm's mouse tracking in the SGR (1006) encoding and bracketed paste, for
+ * terminals that lack the extended capabilities for them */
+#define MOUSE_ON "\033[?1000h\033[?1002h\033[?1006h"
+#define MOUSE_OFF "\033[?1006l\033[?1002l\033[?1000l"
+#define PASTE_ON "\033[?2004h"
+#define PASTE_OFF "\033[?2004l"
+#define PASTE_START "\033[200~"
+#define PASTE_END "\033[201~"
+/* XM leaves out reporting motion with buttons held */
+#define MOUSE_MOTION_ON "\033[?1002h"
+#define MOUSE_MOTION_OFF "\033[?1002l"
+
+/* an extended capability, or xterm's sequence if the terminal lacks it */
+static const char *extended(jx_context *ctx, terminfo_string cap,
+		const char *fallback)
 {
-	/* validate parent window */
-	if (check_window(parent))
-		return NULL;
-	jx_window *win = calloc(sizeof(jx_window), 1);
-	win->x = x;
-	win->y = y;
-	win->w = w;
-	win->h = h;
-	win->buffer_text = malloc(w * h * sizeof(wchar_t));
-	win->buffer_fg = malloc(w * h * sizeof(uint16_t));
-	win->buffer_bg = malloc(w * h * sizeof(uint16_t));
-	win->flags = flags | JX_WF_DIRTY;
-	win->parent = parent;
-	win->prev = window_tail;
-	window_tail->next = win;
-	return win;
+	(void)ctx;
+	return ESCAPE_LENGTH(ctx, cap) ? ESCAPE(ctx, cap) : fallback;
 }
 
-/* destroy a window */
-int jx_destroy_window(jx_window *w)
+/* pick the sequences for the mouse and paste modes */
+static void expand_modes(jx_context *ctx)
 {
-	/* validate window */
-	if (check_window(w))
-		return JX_ERR_INVALID_WINDOW;
-
-	/* destroy children */
-	for (jx_window *a = window_head; a != window_tail; a = a->next)
-		if (a->parent == w)
-			jx_destroy_window(a);
-
-	/* finally destroy window */
-	for (jx_window *a = window_head; a != window_tail; a = a->next) {
-		if (a == w) {
-			if (w->flags & JX_WF_PAD) {
-				free(w->buffer_text);
-				free(w->buffer_fg);
-				free(w->buffer_bg);
-			}
-			a->prev->next = w->next;
-			a->next->prev = w->prev;
-			free(w);
-
-			return JX_SUCCESS;
-		}
+	char *on = ctx->mouse_on, *off = ctx->mouse_off;
+	int k = sizeof(MOUSE_MOTION_ON) - 1;
+	int l = expand_param(ctx, TS_MOUSE_MODE, 1, 0, on,
+	                     MAX_MODE_LENGTH - k - 1);
+	if (l < 0 || l >= MAX_MODE_LENGTH - k - 1) {
+		strcpy(on, MOUSE_ON);
+		strcpy(off, MOUSE_OFF);
+	} else {
+		strcpy(on + l, MOUSE_MOTION_ON);
+		strcpy(off, MOUSE_MOTION_OFF);
+		l = expand_param(ctx, TS_MOUSE_MODE, 0, 0, off + k,
+		                 MAX_MODE_LENGTH - k - 1);
+		off[k + MAX(l, 0)] = '\0';
 	}
-
-	return JX_ERR_INVALID_WINDOW;
+	ctx->paste_on = extended(ctx, TS_PASTE_MODE_ON, PASTE_ON);
+	ctx->paste_off = extended(ctx, TS_PASTE_MODE_OFF, PASTE_OFF);
+	ctx->paste_start = extended(ctx, TS_PASTE_BEGIN, PASTE_START);
+	ctx->paste_end = extended(ctx, TS_PASTE_FINISH, PASTE_END);
+	ctx->paste_start_length = strlen(ctx->paste_start);
+	ctx->paste_end_length = strlen(ctx->paste_end);
 }
 
-/* change a window into a pad */
-int jx_make_pad(jx_window *w, int pw, int ph)
+/* initialise the terminal named, or else the one from the environment with
+ * xterm-256color as the fallback, or the terminal fixed at build time */
+static int init_term(jx_context *ctx, const char *terminal)
 {
-	/* validate window */
-	if (check_window(w))
-		return JX_ERR_INVALID_WINDOW;
+#ifdef JX_TERMINAL
+	if (!terminal)
+		terminal = TERMINAL_NAME;
+#else
+	if (!terminal)
+		terminal = getenv("TERM");
+	if (!terminal)
+		terminal = "xterm-256color";
+#endif
 
-	if (pw < w->w || ph < w->h)
-		return JX_ERR_INVALID_PAD_SIZE;
+	/* TODO: fall intelligently to similar terminal names */
 
-	w->flags |= JX_WF_PAD | JX_WF_DIRTY;
-	if (w->buffer_text)
-		free(w->buffer_text);
-	w->buffer_text = malloc(pw * ph * sizeof(wchar_t));
-	if (w->buffer_fg)
-		free(w->buffer_fg);
-	w->buffer_fg = malloc(pw * ph * sizeof(uint16_t));
-	if (w->buffer_bg)
-		free(w->buffer_bg);
-	w->buffer_bg = malloc(pw * ph * sizeof(uint16_t));
+	if (use_terminal(ctx, terminal))
+		return -1;
+	expand_colours(ctx);
+	expand_modes(ctx);
+	return 0;
+}
 
-	return JX_SUCCESS;
+/* check if terminal has capability */
+static bool has_bool(jx_context *ctx, terminfo_boolean b)
+{
+	if (b >= 32) return (ctx->ttm->caps_ & (1 << (b - 32)));
+	else return (ctx->ttm->caps & (1 << b));
 }
 
-/* move a window */
-int jx_move(jx_window *w, int x, int y)
+/* check if window pointer is valid, with the window list locked, a
+ * destroyed window still points at its context */
+static int check_window(jx_window *w)
 {
-	/* validate window */
-	if (check_window(w))
-		return JX_ERR_INVALID_WINDOW;
-	/* check if any work needs to be done */
-	if (w->x == x && w->y == y)
-		return JX_SUCCESS;
+	for (jx_window *a = w->context->window_head; a; a = a->next)
+		if (w == a)
+			return JX_SUCCESS;
+	return JX_ERR_INVALID_WINDOW;
+}
 
-	/* the parent window is dirty */
-	w->parent->flags |= JX_WF_DIRTY;
-	/* the siblings are dirty if this window overlaps them */
-	for (jx_window *a = window_head; a != window_tail; a = a->next) {
-		/* only process windows that are under this window */
-		if (a == w) break;
-		/* if overlap, mark as dirty */
-		if (a->parent == w->parent &&
-		    a->x < w->x + w->w && a->x + a->w > w->x &&
-		    a->y < w->y + w->h && a->y + a->h > w->y)
-			a->flags |= JX_WF_DIRTY;
+/* lock a window for drawing, other windows can be drawn at the same time */
+static int lock_window(jx_window *w)
+{
+	if (!w || !w->context)
+		return JX_ERR_INVALID_WINDOW;
+	pthread_rwlock_rdlock(&w->context->lock);
+	if (check_window(w)) {
+		pthread_rwlock_unlock(&w->context->lock);
+		return JX_ERR_INVALID_WINDOW;
 	}
-	/* this window is dirty */
-	w->flags |= JX_WF_DIRTY;
-	w->x = x;
-	w->y = y;
-
+	pthread_mutex_lock(&w->lock);
 	return JX_SUCCESS;
 }
 
-int jx_resize(jx_window *win, int w, int h)
+static void unlock_window(jx_window *w)
 {
-	/* validate window */
-	if (check_window(win))
-		return JX_ERR_INVALID_WINDOW;
-	/* check size is valid */
-	if (w <= 0 || h <= 0)
-		return JX_ERR_INVALID_WINDOW_SIZE;
-	/* check if any work needs to be done */
-	if (win->w == w && win->h == h)
-		return JX_SUCCESS;
+	pthread_mutex_unlock(&w->lock);
+	pthread_rwlock_unlock(&w->context->lock);
+}
 
-	win->parent->flags |= JX_WF_DIRTY;
-	/* the siblings are dirty if this window overlaps them */
-	for (jx_window *a = window_head; a != window_tail; a = a->next) {
-		/* only process windows that are under this window */
-		if (a == win) break;
-		/* if overlap, mark as dirty */
-		if (a->parent == win->parent &&
-		    (a->x < win->x + win->w && a->x + a->w > win->x &&
-		    a->y < win->y + win->h && a->y + a->h > win->y) ||
-		    (a->x < win->x + w && a->x + a->w > win->x &&
-		    a->y < win->y + h && a->y + a->h > win->y))
-			a->flags |= JX_WF_DIRTY;
-	}
-	if (win->flags & JX_WF_PAD) {
-		if (win->pw < w || win->ph < h)
-			jx_resize_pad(win, MAX(w, win->pw), MAX(h, win->ph));
-	} else {
-		wchar_t *buffer_text = malloc(w * h * sizeof(wchar_t));
-		memcpy(buffer_text, win->buffer_text, w * h * sizeof(wchar_t));
-		uint16_t *buffer_fg = malloc(w * h * sizeof(uint16_t));
-		memcpy(buffer_fg, win->buffer_fg, w * h * sizeof(uint16_t));
-		uint16_t *buffer_bg = malloc(w * h * sizeof(uint16_t));
-		memcpy(buffer_bg, win->buffer_bg, w * h * sizeof(uint16_t));
-		win->buffer_text = buffer_text;
-		win->buffer_fg = buffer_fg;
-		win->buffer_bg = buffer_bg;
+/* lock the window list of a window's context for changing its structure */
+static int lock_structure(jx_window *w)
+{
+	if (!w || !w->context)
+		return JX_ERR_INVALID_WINDOW;
+	pthread_rwlock_wrlock(&w->context->lock);
+	if (check_window(w)) {
+		pthread_rwlock_unlock(&w->context->lock);
+		return JX_ERR_INVALID_WINDOW;
 	}
-	win->w = w;
-	win->h = h;
-
 	return JX_SUCCESS;
 }
 
-int jx_scroll_pad(jx_window *w, int px, int py)
+static void unlock_structure(jx_window *w)
 {
-	/* validate window */
-	if (check_window(w))
-		return JX_ERR_INVALID_WINDOW;
-	/* validate is pad */
-	if (w->flags & JX_WF_PAD)
-		return JX_ERR_INVALID_PAD;
-	/* check if its in range */
-	if (w->px < 0 || w->py < 0 ||
-	    w->px + w->w > w->pw || w->py + w->h > w->ph)
-		return JX_ERR_OUT_OF_PAD;
-	/* check if any work needs to be done */
-	if (w->px == px && w->py && py)
-		return JX_SUCCESS;
-
-	w->flags |= JX_WF_DIRTY;
-	w->px = px;
-	w->py = py;
-
-	return JX_SUCCESS;
+	pthread_rwlock_unlock(&w->context->lock);
 }
 
-int jx_resize_pad(jx_window *w, int pw, int ph)
+/* mark a window as needing to be drawn in the next frame */
+static inline void set_dirty(jx_window *w)
 {
-	/* validate window */
-	if (check_window(w))
-		return JX_ERR_INVALID_WINDOW;
-	/* validate is pad */
-	if (w->flags & JX_WF_PAD)
-		return JX_ERR_INVALID_PAD;
-	/* check size is valid */
-	if (pw <= 0 || ph <= 0)
-		return JX_ERR_INVALID_PAD_SIZE;
-	/* check if its in range */
-	if (pw < w->w || ph < w->h)
-		return JX_ERR_OUT_OF_PAD;
-	/* move the scroll into range */
-	if (w->px + w->w > pw)
-		w->px = pw - w->w;
-	if (w->py + w->h > ph)
-		w->py = ph - w->h;
-	
-	wchar_t *buffer_text = malloc(pw * ph * sizeof(wchar_t));
-	memcpy(buffer_text, w->buffer_text, pw * ph * sizeof(wchar_t));
-	uint16_t *buffer_fg = malloc(pw * ph * sizeof(uint16_t));
-	memcpy(buffer_fg, w->buffer_fg, pw * ph * sizeof(uint16_t));
-	uint16_t *buffer_bg = malloc(pw * ph * sizeof(uint16_t));
-	memcpy(buffer_bg, w->buffer_bg, pw * ph * sizeof(uint16_t));
-	w->buffer_text = buffer_text;
-	w->buffer_fg = buffer_fg;
-	w->buffer_bg = buffer_bg;
 	w->flags |= JX_WF_DIRTY;
-	w->pw = pw;
-	w->ph = ph;
-
-	return JX_SUCCESS;
+	__atomic_store_n(&w->context->dirty, true, __ATOMIC_RELEASE);
 }
 
-/* set the default foreground for a window */
-void jx_foreground(jx_window *w, uint16_t fg)
+/* width of the cell storage of a window */
+static inline int buffer_width(jx_window *w)
 {
-	w->fg = fg;
-	w->flags |= JX_WF_DIRTY;
+	return w->flags & JX_WF_PAD ? w->pw : w->w;
 }
 
-/* set the default background for a window */
-void jx_background(jx_window *w, uint16_t bg)
+/* height of the cell storage of a window */
+static inline int buffer_height(jx_window *w)
 {
-	w->bg = bg;
-	w->flags |= JX_WF_DIRTY;
+	return w->flags & JX_WF_PAD ? w->ph : w->h;
 }
 
-/* clear the terminal */
-int jx_clear(jx_window *w)
+/* reallocate the cell storage of a window, keeping the overlapping content */
+static void resize_buffers(jx_window *win, int ow, int oh, int w, int h)
 {
-	if (w == window_head) {
-		jx_foreground(w, JX_DEFAULT);
-		jx_background(w, JX_DEFAULT);
-		BUF_PUTE(OUT, TS_EXIT_CA_MODE);
-		BUF_PUTE(OUT, TS_CLEAR_SCREEN);
-		BUF_PUTE(OUT, TS_ENTER_CA_MODE);
-		BUF_DEBUG(OUT);
-		BUF_FLUSH(OUT);
-	} else {
-		/* validate window */
-		if (check_window(w))
-			return JX_ERR_INVALID_WINDOW;
+	wchar_t *buffer_text = calloc(w * h, sizeof(wchar_t));
+	uint16_t *buffer_fg = calloc(w * h, sizeof(uint16_t));
+	uint16_t *buffer_bg = calloc(w * h, sizeof(uint16_t));
+	win->context->stats.buffers_allocated++;
+	if (win->buffer_text) {
+		int cw = MIN(w, ow);
+		for (int y = 0; y < MIN(h, oh); y++) {
+			memcpy(buffer_text + y * w, win->buffer_text + y * ow,
+			       cw * sizeof(wchar_t));
+			memcpy(buffer_fg + y * w, win->buffer_fg + y * ow,
+			       cw * sizeof(uint16_t));
+			memcpy(buffer_bg + y * w, win->buffer_bg + y * ow,
+			       cw * sizeof(uint16_t));
+		}
+	}
+	free(win->buffer_text);
+	free(win->buffer_fg);
+	free(win->buffer_bg);
+	free(win->snapshot);
+	win->snapshot = NULL;
+	win->buffer_text = buffer_text;
+	win->buffer_fg = buffer_fg;
+	win->buffer_bg = buffer_bg;
+}
+
+/* forget what the terminal shows, after it has been cleared */
+static void reset_front(jx_context *ctx)
+{
+	for (int i = 0; i < ctx->front_w * ctx->front_h; i++)
+		ctx->front[i] = (cell){ L' ', 0, 0 };
+	ctx->out_x = ctx->out_y = -1;
+	ctx->out_fg = ctx->out_bg = ATTR_UNKNOWN;
+}
+
+/* decode one utf-8 sequence, returning the number of bytes used */
+static int utf8_decode(const char *s, wchar_t *ch)
+{
+	const unsigned char *u = (const unsigned char *)s;
+	int l = u[0] < 0x80 ? 1 : u[0] < 0xe0 ? 2 : u[0] < 0xf0 ? 3 : 4;
+	uint32_t c = l == 1 ? u[0] : u[0] & (0x7f >> l);
+	for (int i = 1; i < l; i++) {
+		/* truncated or invalid sequence */
+		if ((u[i] & 0xc0) != 0x80) {
+			*ch = 0xfffd;
+			return i;
+		}
+		c = (c << 6) | (u[i] & 0x3f);
+	}
+	*ch = c;
+	return l;
+}
+
+/* open a context on a terminal device of the type named, NULL for $TERM, the
+ * descriptor is owned by the context until jx_close */
+jx_context *jx_open(int fd, const char *terminal)
+{
+	struct winsize size;
+	jx_context *ctx = calloc(sizeof(jx_context), 1);
+	ctx->tty = fd;
+	ctx->winch_fds[0] = ctx->winch_fds[1] = -1;
+
+	if (init_term(ctx, terminal)) {
+		last_error = JX_ERR_UNSUPPORTED_TERMINAL;
+		goto fail;
+	}
+
+	if (ioctl(ctx->tty, TIOCGWINSZ, &size)) {
+		last_error = JX_ERR_IOCTL;
+		goto fail;
+	}
+	ctx->t_columns = size.ws_col;
+	ctx->t_lines = size.ws_row;
+
+	if (tcgetattr(ctx->tty, &ctx->old_t)) {
+		last_error = JX_ERR_TERMIOS;
+		goto fail;
+	}
+
+	struct termios t = ctx->old_t;
+	cfmakeraw(&t);
+	t.c_cc[VMIN] = 0;
+	t.c_cc[VTIME] = 0;
+	if (tcsetattr(ctx->tty, TCSAFLUSH, &t)) {
+		last_error = JX_ERR_TERMIOS;
+		goto fail;
+	}
+
+	BUF_PUTE(ctx, OUT, TS_CLEAR_SCREEN);
+	BUF_PUTE(ctx, OUT, TS_ENTER_CA_MODE);
+	BUF_PUTE(ctx, OUT, TS_KEYPAD_XMIT);
+	BUF_PUTE(ctx, OUT, TS_CURSOR_INVISIBLE);
+	BUF_DEBUG(ctx, OUT);
+	BUF_FLUSH(ctx, OUT);
+
+	/* create first window for the screen */
+	jx_window *screen = calloc(sizeof(jx_window), 1);
+	ctx->window_head = ctx->window_tail = screen;
+	screen->w = ctx->t_columns;
+	screen->h = ctx->t_lines;
+	screen->flags = JX_WF_AUTOSIZE | JX_WF_DIRTY;
+	screen->context = ctx;
+	pthread_mutex_init(&screen->lock, NULL);
+	/* drawing never stops, so let structure changes through */
+	pthread_rwlockattr_t attr;
+	pthread_rwlockattr_init(&attr);
+#ifdef __GLIBC__
+	pthread_rwlockattr_setkind_np(&attr,
+		PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+#endif
+	pthread_rwlock_init(&ctx->lock, &attr);
+	pthread_rwlockattr_destroy(&attr);
+	ctx->dirty = true;
+	ctx->stats.windows_allocated++;
+	resize_buffers(screen, 0, 0, ctx->t_columns, ctx->t_lines);
+
+	/* the terminal starts out cleared with the cursor hidden */
+	ctx->cursor_x = ctx->cursor_y = -1;
+
+	return ctx;
+fail:
+	release_terminfo(ctx);
+	free(ctx);
+	return NULL;
+}
+
+/* restore a terminal and release everything belonging to its context */
+void jx_close(jx_context *ctx)
+{
+	if (!ctx)
+		return;
+	/* clear the screen and restore mode */
+	if (ctx->mouse)
+		BUF_PUT(ctx, OUT, ctx->mouse_off, strlen(ctx->mouse_off));
+	if (ctx->paste)
+		BUF_PUT(ctx, OUT, ctx->paste_off, strlen(ctx->paste_off));
+	BUF_PUTE(ctx, OUT, TS_CURSOR_NORMAL);
+	BUF_PUTE(ctx, OUT, TS_EXIT_ATTRIBUTE_MODE);
+	BUF_PUTE(ctx, OUT, TS_CLEAR_SCREEN);
+	BUF_PUTE(ctx, OUT, TS_KEYPAD_LOCAL);
+	BUF_PUTE(ctx, OUT, TS_EXIT_CA_MODE);
+	BUF_FLUSH(ctx, OUT);
+	/* restore terminal settings */
+	tcsetattr(ctx->tty, TCSAFLUSH, &ctx->old_t);
+	close(ctx->tty);
+	if (ctx == winch_context) {
+		signal(SIGWINCH, SIG_DFL);
+		winch_context = NULL;
+		close(ctx->winch_fds[0]);
+		close(ctx->winch_fds[1]);
+	}
+	/* release the windows and the render state */
+	while (ctx->window_head) {
+		jx_window *next = ctx->window_head->next;
+		free(ctx->window_head->buffer_text);
+		free(ctx->window_head->buffer_fg);
+		free(ctx->window_head->buffer_bg);
+		free(ctx->window_head->snapshot);
+		pthread_mutex_destroy(&ctx->window_head->lock);
+		free(ctx->window_head);
+		ctx->window_head = next;
+	}
+	while (ctx->free_windows) {
+		jx_window *next = ctx->free_windows->next;
+		free(ctx->free_windows);
+		ctx->free_windows = next;
+	}
+	free(ctx->front);
+	free(ctx->back);
+	free(ctx->paste_buffer);
+	free(ctx->pending);
+	release_terminfo(ctx);
+	pthread_rwlock_destroy(&ctx->lock);
+	if (ctx == current)
+		current = NULL;
+	free(ctx);
+}
+
+/* make a context the one used by calls on this thread not given one */
+void jx_select(jx_context *ctx)
+{
+	current = ctx;
+}
+
+/* the context used by calls on this thread not given one */
+jx_context *jx_selected()
+{
+	return current;
+}
+
+/* initialise the library and sets up the terminal */
+int jx_initialise()
+{
+	int fd = open("/dev/tty", O_RDWR);
+	if (fd < 0)
+		return JX_ERR_OPEN_TTY;
+
+	int err = jx_initialise_fd(fd);
+	if (err)
+		close(fd);
+	return err;
+}
+
+/* initialise the library on an already open terminal device, the descriptor
+ * is owned by the library until jx_terminate */
+int jx_initialise_fd(int fd)
+{
+	int winch_fds[2];
+	if (winch_context || pipe(winch_fds))
+		return JX_ERR_PIPE_TRAP_ERROR;
+
+	jx_context *ctx = jx_open(fd, NULL);
+	if (!ctx) {
+		close(winch_fds[0]);
+		close(winch_fds[1]);
+		return last_error;
+	}
+
+	/* follow the size of the terminal through SIGWINCH */
+	ctx->winch_fds[0] = winch_fds[0];
+	ctx->winch_fds[1] = winch_fds[1];
+	winch_context = ctx;
+
+	struct sigaction sa;
+	sigemptyset(&sa.sa_mask);
+	sa.sa_flags = 0;
+	sa.sa_handler = sigwinch_handler;
+	sigaction(SIGWINCH, &sa, 0);
+
+	current = ctx;
+
+	return JX_SUCCESS;
+}
+
+/* finalise everything */
+void jx_terminate()
+{
+	jx_close(current);
+}
+
+/* set the terminal */
+int jx_set_terminal(const char *terminal)
+{
+	if (!current)
+		return JX_ERR_NOT_INIT;
+	if (use_terminal(current, terminal))
+		return JX_ERR_UNSUPPORTED_TERMINAL;
+	expand_colours(current);
+	expand_modes(current);
+	return JX_SUCCESS;
+}
+
+/* get the top level main screen window */
+jx_window *jx_screen()
+{
+	return current ? current->window_head : NULL;
+}
+
+/* create a window to edit */
+jx_window *jx_create_window(jx_window *parent, int x, int y, int w, int h,
+		int flags)
+{
+	/* laid out windows get their size from jx_layout */
+	bool laid_out = flags & LAYOUT_FLAGS;
+	if (!laid_out && (w <= 0 || h <= 0))
+		return NULL;
+	/* validate parent window */
+	if (lock_structure(parent))
+		return NULL;
+	jx_context *ctx = parent->context;
+	jx_window *win = ctx->free_windows;
+	if (win) {
+		ctx->free_windows = win->next;
+		memset(win, 0, sizeof(jx_window));
+	} else {
+		win = calloc(sizeof(jx_window), 1);
+		ctx->stats.windows_allocated++;
+	}
+	win->context = ctx;
+	win->x = x;
+	win->y = y;
+	win->w = MAX(w, 1);
+	win->h = MAX(h, 1);
+	resize_buffers(win, 0, 0, win->w, win->h);
+	win->flags = flags;
+	win->parent = parent;
+	if (laid_out) {
+		win->ax = x;
+		win->ay = y;
+		win->aw = w;
+		win->ah = h;
+		parent->flags |= JX_WF_LAYOUT;
+		ctx->layout = true;
+	}
+	pthread_mutex_init(&win->lock, NULL);
+	win->prev = ctx->window_tail;
+	ctx->window_tail->next = win;
+	ctx->window_tail = win;
+	set_dirty(win);
+	unlock_structure(parent);
+	return win;
+}
+
+/* destroy a window with the window list locked */
+static void destroy_window(jx_window *w)
+{
+	jx_context *ctx = w->context;
+
+	/* destroy children, rescanning as the list changes underneath */
+	for (jx_window *a = w->next; a; a = a->next) {
+		if (a->parent == w) {
+			destroy_window(a);
+			a = w;
+		}
+	}
+
+	/* uncover whatever was underneath */
+	for (jx_window *a = ctx->window_head; a != w; a = a->next)
+		set_dirty(a);
+	/* docked siblings take up the space */
+	if (w->flags & LAYOUT_FLAGS) {
+		w->parent->flags |= JX_WF_LAYOUT;
+		ctx->layout = true;
+	}
+
+	/* finally destroy window */
+	w->prev->next = w->next;
+	if (w->next)
+		w->next->prev = w->prev;
+	else
+		ctx->window_tail = w->prev;
+	free(w->buffer_text);
+	free(w->buffer_fg);
+	free(w->buffer_bg);
+	free(w->snapshot);
+	w->buffer_text = NULL;
+	w->buffer_fg = w->buffer_bg = NULL;
+	w->snapshot = NULL;
+	pthread_mutex_destroy(&w->lock);
+	w->next = ctx->free_windows;
+	ctx->free_windows = w;
+}
+
+/* destroy a window */
+int jx_destroy_window(jx_window *w)
+{
+	/* validate window */
+	if (lock_structure(w))
+		return JX_ERR_INVALID_WINDOW;
+	/* the screen can only go with its context */
+	jx_window *screen = w->context->window_head;
+	int err = w == screen ? JX_ERR_INVALID_WINDOW : JX_SUCCESS;
+	if (!err)
+		destroy_window(w);
+	unlock_structure(screen);
+
+	return err;
+}
+
+/* change a window into a pad */
+int jx_make_pad(jx_window *w, int pw, int ph)
+{
+	/* validate window */
+	if (lock_structure(w))
+		return JX_ERR_INVALID_WINDOW;
+
+	int err = JX_SUCCESS;
+	if (pw < w->w || ph < w->h) {
+		err = JX_ERR_INVALID_PAD_SIZE;
+	} else {
+		w->flags |= JX_WF_PAD;
+		resize_buffers(w, w->w, w->h, pw, ph);
+		w->pw = pw;
+		w->ph = ph;
+		w->px = w->py = 0;
+		set_dirty(w);
+	}
+
+	unlock_structure(w);
+	return err;
+}
+
+/* move a window with the window list locked */
+static void move_window(jx_window *w, int x, int y)
+{
+	/* check if any work needs to be done */
+	if (w->x == x && w->y == y)
+		return;
+
+	/* the parent window is dirty */
+	set_dirty(w->parent);
+	/* the siblings are dirty if this window overlaps them */
+	for (jx_window *a = w->context->window_head; a != w; a = a->next) {
+		/* if overlap, mark as dirty */
+		if (a->parent == w->parent &&
+		    a->x < w->x + w->w && a->x + a->w > w->x &&
+		    a->y < w->y + w->h && a->y + a->h > w->y)
+			set_dirty(a);
+	}
+	/* this window is dirty */
+	set_dirty(w);
+	w->x = x;
+	w->y = y;
+}
+
+/* move a window */
+int jx_move(jx_window *w, int x, int y)
+{
+	/* validate window */
+	if (lock_structure(w))
+		return JX_ERR_INVALID_WINDOW;
+	/* the screen does not move */
+	int err = w->parent ? JX_SUCCESS : JX_ERR_INVALID_WINDOW;
+	if (!err)
+		move_window(w, x, y);
+	unlock_structure(w);
+	return err;
+}
+
+/* resize a pad's storage with the window list locked */
+static int resize_pad(jx_window *w, int pw, int ph)
+{
+	/* validate is pad */
+	if (!(w->flags & JX_WF_PAD))
+		return JX_ERR_INVALID_PAD;
+	/* check size is valid */
+	if (pw <= 0 || ph <= 0)
+		return JX_ERR_INVALID_PAD_SIZE;
+	/* check if its in range */
+	if (pw < w->w || ph < w->h)
+		return JX_ERR_OUT_OF_PAD;
+	/* move the scroll into range */
+	if (w->px + w->w > pw)
+		w->px = pw - w->w;
+	if (w->py + w->h > ph)
+		w->py = ph - w->h;
+
+	resize_buffers(w, w->pw, w->ph, pw, ph);
+	set_dirty(w);
+	w->pw = pw;
+	w->ph = ph;
+
+	return JX_SUCCESS;
+}
+
+/* change the size of a window and its storage with the window list locked */
+static void set_size(jx_window *win, int w, int h)
+{
+	if (win->flags & JX_WF_PAD) {
+		if (win->pw < w || win->ph < h)
+			resize_pad(win, MAX(w, win->pw), MAX(h, win->ph));
+	} else {
+		resize_buffers(win, win->w, win->h, w, h);
+	}
+	set_dirty(win);
+	win->w = w;
+	win->h = h;
+	/* the children are laid out again */
+	win->flags |= JX_WF_LAYOUT;
+	win->context->layout = true;
+}
+
+/* resize a window with the window list locked */
+static void resize_window(jx_window *win, int w, int h)
+{
+	/* check if any work needs to be done */
+	if (win->w == w && win->h == h)
+		return;
+
+	if (win->parent) {
+		set_dirty(win->parent);
+		/* the siblings are dirty if this window overlaps them */
+		for (jx_window *a = win->context->window_head; a != win;
+		     a = a->next) {
+			/* if overlap before or after the resize, mark as dirty */
+			if (a->parent == win->parent &&
+			    ((a->x < win->x + win->w && a->x + a->w > win->x &&
+			    a->y < win->y + win->h && a->y + a->h > win->y) ||
+			    (a->x < win->x + w && a->x + a->w > win->x &&
+			    a->y < win->y + h && a->y + a->h > win->y)))
+				set_dirty(a);
+		}
+	} else {
+		win->context->t_columns = w;
+		win->context->t_lines = h;
+	}
+	set_size(win, w, h);
+}
+
+/* resize a window, resizing the screen follows a terminal size change */
+int jx_resize(jx_window *win, int w, int h)
+{
+	/* check size is valid */
+	if (w <= 0 || h <= 0)
+		return JX_ERR_INVALID_WINDOW_SIZE;
+	/* validate window */
+	if (lock_structure(win))
+		return JX_ERR_INVALID_WINDOW;
+	resize_window(win, w, h);
+	unlock_structure(win);
+	return JX_SUCCESS;
+}
+
+int jx_scroll_pad(jx_window *w, int px, int py)
+{
+	/* validate window */
+	if (lock_structure(w))
+		return JX_ERR_INVALID_WINDOW;
+
+	int err = JX_SUCCESS;
+	/* validate is pad */
+	if (!(w->flags & JX_WF_PAD))
+		err = JX_ERR_INVALID_PAD;
+	/* check if its in range */
+	else if (px < 0 || py < 0 ||
+	    px + w->w > w->pw || py + w->h > w->ph)
+		err = JX_ERR_OUT_OF_PAD;
+	/* check if any work needs to be done */
+	else if (w->px != px || w->py != py) {
+		set_dirty(w);
+		w->px = px;
+		w->py = py;
+	}
+
+	unlock_structure(w);
+	return err;
+}
+
+int jx_resize_pad(jx_window *w, int pw, int ph)
+{
+	/* validate window */
+	if (lock_structure(w))
+		return JX_ERR_INVALID_WINDOW;
+	int err = resize_pad(w, pw, ph);
+	unlock_structure(w);
+	return err;
+}
+
+/* change how a window is laid out within its parent */
+int jx_set_layout(jx_window *w, int flags, int ax, int ay, int aw, int ah)
+{
+	/* validate window */
+	if (lock_structure(w))
+		return JX_ERR_INVALID_WINDOW;
+	/* the screen follows the terminal */
+	if (!w->parent) {
+		unlock_structure(w);
+		return JX_ERR_INVALID_WINDOW;
+	}
+
+	w->flags = (w->flags & ~LAYOUT_FLAGS) | (flags & LAYOUT_FLAGS);
+	w->ax = ax;
+	w->ay = ay;
+	w->aw = aw;
+	w->ah = ah;
+	/* the siblings are laid out again as docking depends on them all */
+	w->parent->flags |= JX_WF_LAYOUT;
+	w->context->layout = true;
+
+	unlock_structure(w);
+	return JX_SUCCESS;
+}
+
+/* set the default foreground for a window */
+void jx_foreground(jx_window *w, uint16_t fg)
+{
+	if (lock_window(w))
+		return;
+	w->fg = fg;
+	set_dirty(w);
+	unlock_window(w);
+}
+
+/* set the default background for a window */
+void jx_background(jx_window *w, uint16_t bg)
+{
+	if (lock_window(w))
+		return;
+	w->bg = bg;
+	set_dirty(w);
+	unlock_window(w);
+}
+
+/* put a character in a window using the window's colours */
+int jx_putc(jx_window *w, int x, int y, wchar_t ch)
+{
+	/* validate window */
+	if (lock_window(w))
+		return JX_ERR_INVALID_WINDOW;
+	if (x < 0 || y < 0 || x >= buffer_width(w) || y >= buffer_height(w)) {
+		unlock_window(w);
+		return w->flags & JX_WF_PAD ?
+			JX_ERR_OUT_OF_PAD : JX_ERR_OUT_OF_WINDOW;
+	}
+
+	int i = y * buffer_width(w) + x;
+	w->buffer_text[i] = ch;
+	w->buffer_fg[i] = w->fg;
+	w->buffer_bg[i] = w->bg;
+	set_dirty(w);
+
+	unlock_window(w);
+	return JX_SUCCESS;
+}
+
+/* check a box lies within the storage of a window */
+static int check_box(jx_window *win, int x, int y, int w, int h)
+{
+	if (x < 0 || y < 0 || w <= 0 || h <= 0 ||
+	    x + w > buffer_width(win) || y + h > buffer_height(win))
+		return win->flags & JX_WF_PAD ?
+			JX_ERR_OUT_OF_PAD : JX_ERR_OUT_OF_WINDOW;
+	return JX_SUCCESS;
+}
+
+/* write utf-8 text into a box from the position cx, cy, returning false
+ * once the box is full */
+static bool write_text(jx_window *win, int x, int y, int w, int h,
+		int *cx, int *cy, const char *text, uint16_t fg, uint16_t bg)
+{
+	int bw = buffer_width(win);
+	while (*text) {
+		wchar_t ch;
+		text += utf8_decode(text, &ch);
+		if (ch == L'\n') {
+			*cx = x;
+			if (++*cy == y + h)
+				return false;
+			continue;
+		}
+		if (*cx == x + w) {
+			*cx = x;
+			if (++*cy == y + h)
+				return false;
+		}
+		int i = *cy * bw + (*cx)++;
+		win->buffer_text[i] = ch;
+		win->buffer_fg[i] = fg;
+		win->buffer_bg[i] = bg;
+	}
+	return true;
+}
+
+/* write utf-8 text into a box of a window, wrapping at the box's edge */
+int jx_write(jx_window *win, int x, int y, int w, int h, const char *text)
+{
+	/* validate window */
+	if (lock_window(win))
+		return JX_ERR_INVALID_WINDOW;
+	int err = check_box(win, x, y, w, h);
+	if (!err) {
+		int cx = x, cy = y;
+		write_text(win, x, y, w, h, &cx, &cy, text, win->fg, win->bg);
+		set_dirty(win);
+	}
+
+	unlock_window(win);
+	return err;
+}
+
+/* write runs of text each in their own colours, one after the other */
+int jx_write_spans(jx_window *win, int x, int y, int w, int h,
+		const jx_span *spans, int count)
+{
+	/* validate window */
+	if (lock_window(win))
+		return JX_ERR_INVALID_WINDOW;
+	int err = check_box(win, x, y, w, h);
+	if (!err) {
+		int cx = x, cy = y;
+		for (int i = 0; i < count; i++)
+			if (!write_text(win, x, y, w, h, &cx, &cy,
+			    spans[i].text, spans[i].fg, spans[i].bg))
+				break;
+		set_dirty(win);
+	}
+
+	unlock_window(win);
+	return err;
+}
+
+/* fill a box of a window with one cell */
+int jx_fill(jx_window *win, int x, int y, int w, int h, jx_cell cell)
+{
+	/* validate window */
+	if (lock_window(win))
+		return JX_ERR_INVALID_WINDOW;
+	int err = check_box(win, x, y, w, h);
+	if (!err) {
+		int bw = buffer_width(win), i = y * bw + x;
+		wchar_t *text = win->buffer_text + i;
+		uint16_t *fg = win->buffer_fg + i, *bg = win->buffer_bg + i;
+		/* fill the first line and copy it to the rest */
+		for (int j = 0; j < w; j++) {
+			text[j] = cell.ch;
+			fg[j] = cell.fg;
+			bg[j] = cell.bg;
+		}
+		for (int j = 1; j < h; j++) {
+			memcpy(text + j * bw, text, w * sizeof(wchar_t));
+			memcpy(fg + j * bw, fg, w * sizeof(uint16_t));
+			memcpy(bg + j * bw, bg, w * sizeof(uint16_t));
+		}
+		set_dirty(win);
+	}
+
+	unlock_window(win);
+	return err;
+}
+
+/* copy a box of cells into a window, stride is the cells between lines */
+int jx_blit(jx_window *win, int x, int y, int w, int h,
+		const jx_cell *cells, int stride)
+{
+	/* validate window */
+	if (lock_window(win))
+		return JX_ERR_INVALID_WINDOW;
+	int err = check_box(win, x, y, w, h);
+	if (!err && (!cells || stride < w))
+		err = JX_ERR_OUT_OF_WINDOW;
+	if (!err) {
+		int bw = buffer_width(win);
+		for (int j = 0; j < h; j++, cells += stride) {
+			int i = (y + j) * bw + x;
+			wchar_t *text = win->buffer_text + i;
+			uint16_t *fg = win->buffer_fg + i, *bg = win->buffer_bg + i;
+			for (int k = 0; k < w; k++) {
+				text[k] = cells[k].ch;
+				fg[k] = cells[k].fg;
+				bg[k] = cells[k].bg;
+			}
+		}
+		set_dirty(win);
 	}
 
-	int width = w->flags & JX_WF_PAD ? w->pw : w->w;
-	int height = w->flags & JX_WF_PAD ? w->ph : w->h;
+	unlock_window(win);
+	return err;
+}
+
+/* clear a window, clearing the screen also clears the terminal */
+int jx_clear(jx_window *w)
+{
+	/* validate window */
+	if (lock_window(w))
+		return JX_ERR_INVALID_WINDOW;
+	/* the terminal itself is cleared by the renderer */
+	if (!w->parent) {
+		w->fg = w->bg = JX_DEFAULT;
+		__atomic_store_n(&w->context->clear, true, __ATOMIC_RELEASE);
+	}
+
+	int width = buffer_width(w);
+	int height = buffer_height(w);
 	memset(w->buffer_text, 0, width * height * sizeof(wchar_t));
 	memset(w->buffer_fg, 0, width * height * sizeof(uint16_t));
 	memset(w->buffer_bg, 0, width * height * sizeof(uint16_t));
+	set_dirty(w);
 
+	unlock_window(w);
 	return JX_SUCCESS;
 }
 
 /* return the number of columns in the terminal */
 int jx_columns()
 {
-	return t_columns;
+	return current ? current->t_columns : 0;
 }
 
 /* return the number of lines in the terminal */
 int jx_lines()
 {
-	return t_lines;
+	return current ? current->t_lines : 0;
+}
+
+/* resolve a position and size along one axis of a parent of that size */
+static void layout_axis(int flags, int near, int far, int relative_pos,
+		int relative_size, int a, int as, int size, int *x, int *w)
+{
+	if (flags & relative_pos)
+		a = a * size / 100;
+	if (flags & relative_size)
+		as = as * size / 100;
+	if ((flags & near) && (flags & far)) {
+		/* stretch, keeping both margins */
+		*x = a;
+		*w = size - a - as;
+	} else if (flags & far) {
+		*x = size - a - as;
+		*w = as;
+	} else {
+		*x = a;
+		*w = as;
+	}
+}
+
+/* lay out a window within its parent, docked and autosized ones within what
+ * their earlier siblings left of it */
+static void layout_window(jx_window *w)
+{
+	jx_window *p = w->parent;
+	int f = w->flags, x, y, width, height;
+
+	layout_axis(f, JX_WF_ANCHOR_LEFT, JX_WF_ANCHOR_RIGHT, JX_WF_RELATIVE_X,
+	            JX_WF_RELATIVE_W, w->ax, w->aw, p->w, &x, &width);
+	layout_axis(f, JX_WF_ANCHOR_TOP, JX_WF_ANCHOR_BOTTOM, JX_WF_RELATIVE_Y,
+	            JX_WF_RELATIVE_H, w->ay, w->ah, p->h, &y, &height);
+
+	/* docked windows take a strip off the free area */
+	if (f & (JX_WF_DOCK_LEFT | JX_WF_DOCK_RIGHT)) {
+		width = MIN(MAX(width, 0), p->lw);
+		x = f & JX_WF_DOCK_LEFT ? p->lx : p->lx + p->lw - width;
+		y = p->ly;
+		height = p->lh;
+		if (f & JX_WF_DOCK_LEFT)
+			p->lx += width;
+		p->lw -= width;
+	} else if (f & (JX_WF_DOCK_TOP | JX_WF_DOCK_BOTTOM)) {
+		height = MIN(MAX(height, 0), p->lh);
+		x = p->lx;
+		y = f & JX_WF_DOCK_TOP ? p->ly : p->ly + p->lh - height;
+		width = p->lw;
+		if (f & JX_WF_DOCK_TOP)
+			p->ly += height;
+		p->lh -= height;
+	} else if (f & JX_WF_AUTOSIZE) {
+		/* fill whatever is left */
+		x = p->lx;
+		y = p->ly;
+		width = p->lw;
+		height = p->lh;
+	}
+
+	width = MAX(width, 1);
+	height = MAX(height, 1);
+	if (x == w->x && y == w->y && width == w->w && height == w->h)
+		return;
+	/* every window is composed each frame, so unlike jx_move the parent
+	 * being dirty is enough to uncover the siblings, saving a scan of
+	 * them for each of thousands of windows */
+	set_dirty(p);
+	set_dirty(w);
+	w->x = x;
+	w->y = y;
+	if (width != w->w || height != w->h)
+		set_size(w, width, height);
+}
+
+/* lay out the windows whose parents changed size or had children change
+ * how they are laid out, in one pass as parents come before children */
+int jx_layout()
+{
+	jx_context *ctx = current;
+	if (!ctx)
+		return JX_ERR_NOT_INIT;
+
+	jx_window *screen = ctx->window_head;
+	if (lock_structure(screen))
+		return JX_ERR_INVALID_WINDOW;
+	if (!ctx->layout) {
+		unlock_structure(screen);
+		return JX_SUCCESS;
+	}
+	unsigned int pass = ++ctx->layout_pass;
+
+	for (jx_window *a = ctx->window_head; a; a = a->next) {
+		if (a->parent && a->parent->layout_pass == pass &&
+		    a->flags & LAYOUT_FLAGS)
+			layout_window(a);
+		/* resizing it above may have marked the children */
+		if (a->flags & JX_WF_LAYOUT) {
+			a->flags &= ~JX_WF_LAYOUT;
+			a->layout_pass = pass;
+			a->lx = a->ly = 0;
+			a->lw = a->w;
+			a->lh = a->h;
+		}
+	}
+	/* nothing laid out here needs another pass */
+	ctx->layout = false;
+
+	unlock_structure(screen);
+	return JX_SUCCESS;
+}
+
+/* append a decimal number to the output buffer */
+static void put_number(jx_context *ctx, int n)
+{
+	char s[12];
+	int l = 0;
+	do s[l++] = '0' + n % 10; while (n /= 10);
+	while (l)
+		BUF_PUTC(ctx, OUT, s[--l]);
+}
+
+/* move the terminal cursor, ansi terminals lacking cursor_address */
+static void put_cursor(jx_context *ctx, int x, int y)
+{
+	char s[64];
+	int l = expand_param(ctx, TS_CURSOR_ADDRESS, y, x, s, sizeof(s));
+	if (l >= 0) {
+		BUF_PUT(ctx, OUT, s, l);
+	} else {
+		BUF_PUT(ctx, OUT, "\033[", 2);
+		put_number(ctx, y + 1);
+		BUF_PUTC(ctx, OUT, ';');
+		put_number(ctx, x + 1);
+		BUF_PUTC(ctx, OUT, 'H');
+	}
+	ctx->out_x = x;
+	ctx->out_y = y;
+}
+
+/* switch the terminal over to the attributes of a cell */
+static void put_attr(jx_context *ctx, uint16_t fg, uint16_t bg)
+{
+	BUF_PUTE(ctx, OUT, TS_EXIT_ATTRIBUTE_MODE);
+	if (fg & JX_BOLD)
+		BUF_PUTE(ctx, OUT, TS_ENTER_BOLD_MODE);
+	if (fg & JX_UNDERLINE)
+		BUF_PUTE(ctx, OUT, TS_ENTER_UNDERLINE_MODE);
+	if (fg & JX_REVERSE)
+		BUF_PUTE(ctx, OUT, TS_ENTER_REVERSE_MODE);
+	if (fg & 0x0f) {
+		int c = ((fg & 0x0f) - 1) & 7;
+		BUF_PUT(ctx, OUT, ctx->colour[0][c], ctx->colour_length[0][c]);
+	}
+	if (bg & 0x0f) {
+		int c = ((bg & 0x0f) - 1) & 7;
+		BUF_PUT(ctx, OUT, ctx->colour[1][c], ctx->colour_length[1][c]);
+	}
+	ctx->out_fg = fg;
+	ctx->out_bg = bg;
+}
+
+/* append a character to the output buffer as utf-8 */
+static void put_char(jx_context *ctx, wchar_t ch)
+{
+	uint32_t c = ch;
+	if (c < 0x80) {
+		BUF_PUTC(ctx, OUT, c);
+	} else if (c < 0x800) {
+		BUF_PUTC(ctx, OUT, 0xc0 | (c >> 6));
+		BUF_PUTC(ctx, OUT, 0x80 | (c & 0x3f));
+	} else if (c < 0x10000) {
+		BUF_PUTC(ctx, OUT, 0xe0 | (c >> 12));
+		BUF_PUTC(ctx, OUT, 0x80 | ((c >> 6) & 0x3f));
+		BUF_PUTC(ctx, OUT, 0x80 | (c & 0x3f));
+	} else {
+		BUF_PUTC(ctx, OUT, 0xf0 | ((c >> 18) & 0x07));
+		BUF_PUTC(ctx, OUT, 0x80 | ((c >> 12) & 0x3f));
+		BUF_PUTC(ctx, OUT, 0x80 | ((c >> 6) & 0x3f));
+		BUF_PUTC(ctx, OUT, 0x80 | (c & 0x3f));
+	}
+}
+
+/* find where a window lands on the screen and the part of it that shows */
+static void window_area(jx_window *w, int *ox, int *oy,
+		int *x0, int *y0, int *x1, int *y1)
+{
+	if (!w->parent) {
+		*ox = *oy = *x0 = *y0 = 0;
+		*x1 = w->w;
+		*y1 = w->h;
+		return;
+	}
+	window_area(w->parent, ox, oy, x0, y0, x1, y1);
+	*ox += w->x;
+	*oy += w->y;
+	*x0 = MAX(*x0, *ox);
+	*y0 = MAX(*y0, *oy);
+	*x1 = MIN(*x1, *ox + w->w);
+	*y1 = MIN(*y1, *oy + w->h);
+}
+
+/* draw a window into the next frame */
+static void compose(jx_context *ctx, jx_window *w,
+		const struct jx_snapshot_s *snap)
+{
+	int ox, oy, x0, y0, x1, y1;
+	window_area(w, &ox, &oy, &x0, &y0, &x1, &y1);
+	/* the flags of a busy window are not ours to read */
+	int bw = snap ? snap->w : buffer_width(w);
+	/* only pads scroll, windows keep px and py at zero */
+	int sx = w->px, sy = w->py;
+	for (int y = y0; y < y1; y++) {
+		int src = (sy + y - oy) * bw + sx + x0 - ox;
+		cell *dst = ctx->back + y * ctx->front_w + x0;
+		if (snap) {
+			memcpy(dst, snap->cells + src, (x1 - x0) * sizeof(cell));
+			continue;
+		}
+		for (int x = x0; x < x1; x++, src++, dst++) {
+			dst->ch = w->buffer_text[src] ? w->buffer_text[src] : L' ';
+			dst->fg = w->buffer_fg[src] ? w->buffer_fg[src] : w->fg;
+			dst->bg = w->buffer_bg[src] ? w->buffer_bg[src] : w->bg;
+		}
+	}
+}
+
+/* keep a copy of a window to render while it is busy, with it locked */
+static void take_snapshot(jx_window *w)
+{
+	int n = buffer_width(w) * buffer_height(w);
+	if (!w->snapshot) {
+		w->snapshot = malloc(sizeof(struct jx_snapshot_s) +
+		                     n * sizeof(cell));
+		w->context->stats.buffers_allocated++;
+	}
+	w->snapshot->w = buffer_width(w);
+	for (int i = 0; i < n; i++) {
+		cell *c = w->snapshot->cells + i;
+		c->ch = w->buffer_text[i] ? w->buffer_text[i] : L' ';
+		c->fg = w->buffer_fg[i] ? w->buffer_fg[i] : w->fg;
+		c->bg = w->buffer_bg[i] ? w->buffer_bg[i] : w->bg;
+	}
+}
+
+/* draw the windows onto the terminal, sending only the cells that changed */
+void jx_render()
+{
+	jx_context *ctx = current;
+	if (!ctx)
+		return;
+
+	uint64_t start = clock_ns(), bytes = ctx->stats.bytes_written, cells = 0;
+	bool dirty = ctx->cursor_dirty;
+
+	/* a terminal still busy with the last frame gets the next one once it
+	 * has caught up, see jx_flush */
+	if (ctx->pending_length)
+		send_pending(ctx);
+	if (ctx->pending_length) {
+		ctx->stats.frames_skipped++;
+		return;
+	}
+
+	/* snapshot the windows, holding each only while it is copied */
+	pthread_rwlock_rdlock(&ctx->lock);
+	int w = ctx->window_head->w, h = ctx->window_head->h;
+	/* the screen has changed size, start again from a blank terminal */
+	if (ctx->front_w != w || ctx->front_h != h) {
+		free(ctx->front);
+		free(ctx->back);
+		ctx->front = malloc(w * h * sizeof(cell));
+		ctx->back = malloc(w * h * sizeof(cell));
+		ctx->stats.buffers_allocated += 2;
+		ctx->front_w = w;
+		ctx->front_h = h;
+		BUF_PUTE(ctx, OUT, TS_CLEAR_SCREEN);
+		reset_front(ctx);
+		dirty = true;
+	}
+	if (__atomic_exchange_n(&ctx->clear, false, __ATOMIC_ACQ_REL)) {
+		BUF_PUTE(ctx, OUT, TS_EXIT_CA_MODE);
+		BUF_PUTE(ctx, OUT, TS_CLEAR_SCREEN);
+		BUF_PUTE(ctx, OUT, TS_ENTER_CA_MODE);
+		reset_front(ctx);
+	}
+	if (__atomic_exchange_n(&ctx->dirty, false, __ATOMIC_ACQ_REL))
+		dirty = true;
+	if (!dirty) {
+		pthread_rwlock_unlock(&ctx->lock);
+		ctx->stats.frames_skipped++;
+		return;
+	}
+
+	/* composite windows bottom to top, a window busy being drawn into is
+	 * taken from its last copy and picked up again in the next frame */
+	for (jx_window *a = ctx->window_head; a; a = a->next) {
+		if (pthread_mutex_trylock(&a->lock)) {
+			if (a->snapshot) {
+				compose(ctx, a, a->snapshot);
+				__atomic_store_n(&ctx->dirty, true,
+				                 __ATOMIC_RELEASE);
+				continue;
+			}
+			/* the first time, wait and keep copies from now on */
+			pthread_mutex_lock(&a->lock);
+			take_snapshot(a);
+		} else if (a->snapshot && a->flags & JX_WF_DIRTY) {
+			take_snapshot(a);
+		}
+		compose(ctx, a, NULL);
+		a->flags &= ~JX_WF_DIRTY;
+		pthread_mutex_unlock(&a->lock);
+	}
+	pthread_rwlock_unlock(&ctx->lock);
+
+	/* send the difference */
+	for (int y = 0; y < h; y++) {
+		cell *b = ctx->back + y * w, *f = ctx->front + y * w;
+		for (int x = 0; x < w; x++, b++, f++) {
+			if (b->ch == f->ch && b->fg == f->fg && b->bg == f->bg)
+				continue;
+			BUF_FLUSHIF(ctx, OUT);
+			if (x != ctx->out_x || y != ctx->out_y)
+				put_cursor(ctx, x, y);
+			if (b->fg != ctx->out_fg || b->bg != ctx->out_bg)
+				put_attr(ctx, b->fg, b->bg);
+			put_char(ctx, b->ch);
+			*f = *b;
+			cells++;
+			/* the cursor is left in limbo at the right margin */
+			ctx->out_x = x + 1 < w ? x + 1 : -1;
+		}
+	}
+
+	/* place the cursor */
+	if (ctx->cursor_x >= 0 && ctx->cursor_y >= 0 &&
+	    ctx->cursor_x < w && ctx->cursor_y < h) {
+		put_cursor(ctx, ctx->cursor_x, ctx->cursor_y);
+		if (!ctx->cursor_visible)
+			BUF_PUTE(ctx, OUT, TS_CURSOR_NORMAL);
+		ctx->cursor_visible = true;
+	} else if (ctx->cursor_visible) {
+		BUF_PUTE(ctx, OUT, TS_CURSOR_INVISIBLE);
+		ctx->cursor_visible = false;
+	}
+	ctx->cursor_dirty = false;
+
+	BUF_DEBUG(ctx, OUT);
+	if (ctx->OUT_index)
+		BUF_FLUSH(ctx, OUT);
+
+	ctx->stats.frames_rendered++;
+	ctx->stats.cells_diffed += w * h;
+	ctx->stats.cells_emitted += cells;
+	ctx->stats.frame_ns = clock_ns() - start;
+	ctx->stats.frame_bytes = ctx->stats.bytes_written - bytes;
+	ctx->stats.frame_cells = cells;
+	histogram_add(ctx->stats.render_ns, ctx->stats.frame_ns);
+	if (ctx->frame_hook)
+		ctx->frame_hook(&ctx->stats, ctx->frame_hook_data);
+}
+
+/* send output queued for a non-blocking terminal, returning the bytes the
+ * terminal has still not taken */
+int jx_flush()
+{
+	jx_context *ctx = current;
+	if (!ctx)
+		return JX_ERR_NOT_INIT;
+	if (ctx->pending_length)
+		send_pending(ctx);
+	return ctx->pending_length;
+}
+
+/* show the cursor at a position on the screen, or hide it if off screen */
+void jx_cursor(int cx, int cy)
+{
+	jx_context *ctx = current;
+	if (!ctx)
+		return;
+	ctx->cursor_x = cx;
+	ctx->cursor_y = cy;
+	ctx->cursor_dirty = true;
+}
+
+/* switch a terminal mode, from the thread handling events */
+static int set_mode(bool *mode, int enable, const char *on, const char *off)
+{
+	jx_context *ctx = current;
+	if (*mode == !!enable)
+		return JX_SUCCESS;
+	*mode = enable;
+	const char *s = enable ? on : off;
+	BUF_PUT(ctx, OUT, s, strlen(s));
+	BUF_FLUSH(ctx, OUT);
+	return JX_SUCCESS;
+}
+
+/* report the mouse as events */
+int jx_set_mouse(int enable)
+{
+	if (!current)
+		return JX_ERR_NOT_INIT;
+	return set_mode(&current->mouse, enable, current->mouse_on,
+	                current->mouse_off);
+}
+
+/* deliver pastes as one event rather than as keys */
+int jx_set_paste(int enable)
+{
+	if (!current)
+		return JX_ERR_NOT_INIT;
+	return set_mode(&current->paste, enable, current->paste_on,
+	                current->paste_off);
+}
+
+/* decode an SGR mouse report, \033[<b;x;yM or m for a release, returning
+ * the bytes it used, zero if incomplete or -1 if it is not one */
+static int decode_mouse(jx_context *ctx, jx_event *e)
+{
+	int n[3] = { 0, 0, 0 }, f = 0, i = 3;
+	for (; i < ctx->IN_index; i++) {
+		char c = ctx->IN[i];
+		if (c >= '0' && c <= '9' && n[f] < 100000)
+			n[f] = n[f] * 10 + c - '0';
+		else if (c == ';' && f < 2)
+			f++;
+		else if ((c == 'M' || c == 'm') && f == 2)
+			break;
+		else
+			return -1;
+	}
+	if (i == ctx->IN_index)
+		return 0;
+
+	int b = n[0];
+	e->type = JX_EVENT_MOUSE;
+	e->x = n[1] - 1;
+	e->y = n[2] - 1;
+	if (b & 4)
+		e->mod |= JX_MOD_SHIFT;
+	if (b & 8)
+		e->mod |= JX_MOD_ALT;
+	if (b & 16)
+		e->mod |= JX_MOD_CTRL;
+	if (b & 32)
+		e->mod |= JX_MOD_MOTION;
+	if (b & 64)
+		e->key = b & 1 ? JX_KEY_MOUSE_WHEEL_DOWN : JX_KEY_MOUSE_WHEEL_UP;
+	else if (ctx->IN[i] == 'm') {
+		/* unlike the older encodings SGR says which button */
+		e->key = JX_KEY_MOUSE_LEFT - (b & 3);
+		e->mod |= JX_MOD_RELEASE;
+	} else if ((b & 3) == 3)
+		e->key = JX_KEY_MOUSE_RELEASE;
+	else
+		e->key = JX_KEY_MOUSE_LEFT - (b & 3);
+	return i + 1;
+}
+
+/* whether the input so far is an escape that is the start of a longer
+ * sequence, a key, a mouse report or the start of a paste */
+static bool partial_escape(jx_context *ctx)
+{
+	int n = ctx->IN_index;
+	if (ctx->IN[0] != '\033')
+		return false;
+	if (n < 3 && !memcmp(ctx->IN, "\033[<", n))
+		return true;
+	if (ctx->paste && (size_t)n < ctx->paste_start_length &&
+	    !memcmp(ctx->IN, ctx->paste_start, n))
+		return true;
+	for (int i = TS_KEY_F1; i <= TS_KEY_RIGHT; i++)
+		if (n < ESCAPE_LENGTH(ctx, i) &&
+		    !memcmp(ctx->IN, ESCAPE(ctx, i), n))
+			return true;
+	return false;
+}
+
+/* decode one event from the input buffer, returning the bytes it used or
+ * zero to wait for more, unless forced to take an escape as it is */
+static int decode_event(jx_context *ctx, jx_event *e, bool force)
+{
+	memset(e, 0, sizeof(jx_event));
+	e->type = JX_EVENT_KEY;
+
+	/* the start of a paste, which jx_peek collects */
+	size_t m = ctx->paste_start_length;
+	if (ctx->paste && (size_t)ctx->IN_index >= m &&
+	    !memcmp(ctx->IN, ctx->paste_start, m)) {
+		e->type = JX_EVENT_PASTE;
+		return m;
+	}
+
+	/* mouse reports */
+	if (ctx->IN_index >= 3 && !memcmp(ctx->IN, "\033[<", 3)) {
+		int l = decode_mouse(ctx, e);
+		/* a report too long for the buffer is thrown away */
+		if (!l && ctx->IN_index == MAX_INPUT_BUFFER)
+			return ctx->IN_index;
+		if (l > 0 || (!l && !force))
+			return l;
+		memset(e, 0, sizeof(jx_event));
+		e->type = JX_EVENT_KEY;
+	}
+
+	/* special keys */
+	for (int i = TS_KEY_F1; i <= TS_KEY_RIGHT; i++) {
+		int l = ESCAPE_LENGTH(ctx, i);
+		if (l && l <= ctx->IN_index && !memcmp(ctx->IN, ESCAPE(ctx, i), l)) {
+			e->key = JX_KEY_F1 - (i - TS_KEY_F1);
+			return l;
+		}
+	}
+
+	if (!force && partial_escape(ctx))
+		return 0;
+
+	/* alt modified keys arrive prefixed with an escape */
+	int l = 0;
+	if (ctx->IN[0] == '\033' && ctx->IN_index > 1) {
+		e->mod = JX_MOD_ALT;
+		l = 1;
+	}
+	unsigned char c = ctx->IN[l];
+	if (c < 0x20 || c == 0x7f) {
+		e->key = c;
+		return l + 1;
+	}
+	/* wait for the rest of a character */
+	if (c >= 0x80 && l + (c < 0xe0 ? 2 : c < 0xf0 ? 3 : 4) > ctx->IN_index)
+		return 0;
+	wchar_t ch;
+	l += utf8_decode(ctx->IN + l, &ch);
+	e->ch = ch;
+	return l;
+}
+
+/* read whatever input there is room for, returning the bytes read */
+static int read_input(jx_context *ctx)
+{
+	int r;
+	/* what followed the last paste comes first */
+	if (ctx->spill_length) {
+		r = MIN(ctx->spill_length,
+		        (size_t)(MAX_INPUT_BUFFER - ctx->IN_index));
+		memcpy(ctx->IN + ctx->IN_index,
+		       ctx->paste_buffer + ctx->spill_offset, r);
+		ctx->spill_offset += r;
+		ctx->spill_length -= r;
+	} else {
+		r = read(ctx->tty, ctx->IN + ctx->IN_index,
+		         MAX_INPUT_BUFFER - ctx->IN_index);
+	}
+	if (r > 0)
+		ctx->IN_index += r;
+	return r;
+}
+
+/* make room for at least n more bytes of paste */
+static int grow_paste(jx_context *ctx, size_t n)
+{
+	if (ctx->paste_buffer && ctx->paste_length + n <= ctx->paste_size)
+		return JX_SUCCESS;
+	size_t size = MAX(ctx->paste_size * 2, 4096);
+	while (size < ctx->paste_length + n)
+		size *= 2;
+	char *buffer = realloc(ctx->paste_buffer, size);
+	if (!buffer)
+		return -1;
+	ctx->paste_buffer = buffer;
+	ctx->paste_size = size;
+	ctx->stats.buffers_allocated++;
+	return JX_SUCCESS;
+}
+
+/* start collecting a paste, beginning with the input that already arrived
+ * after its start */
+static int begin_paste(jx_context *ctx)
+{
+	size_t in = ctx->IN_index, spill = ctx->spill_length;
+	ctx->paste_length = 0;
+	if (grow_paste(ctx, in + spill))
+		return -1;
+	memmove(ctx->paste_buffer + in,
+	        ctx->paste_buffer + ctx->spill_offset, spill);
+	memcpy(ctx->paste_buffer, ctx->IN, in);
+	ctx->paste_length = in + spill;
+	ctx->paste_searched = 0;
+	ctx->spill_length = 0;
+	ctx->IN_index = 0;
+	ctx->pasting = true;
+	return JX_SUCCESS;
+}
+
+/* read the paste straight into its buffer, up to MAX_PASTE of it */
+static int read_paste(jx_context *ctx)
+{
+	size_t n = MAX_PASTE - MIN(ctx->paste_length, MAX_PASTE);
+	if (grow_paste(ctx, MIN(n, 4096)))
+		return -1;
+	int r = read(ctx->tty, ctx->paste_buffer + ctx->paste_length,
+	             MIN(n, ctx->paste_size - ctx->paste_length));
+	if (r > 0)
+		ctx->paste_length += r;
+	return r;
+}
+
+/* look for the end of the paste, making it the event once found or once
+ * there is too much of it to hold */
+static bool end_paste(jx_context *ctx, jx_event *event)
+{
+	/* the part of a long paste given out last time goes */
+	if (ctx->paste_delivered) {
+		ctx->paste_length -= ctx->paste_delivered;
+		ctx->paste_searched -= ctx->paste_delivered;
+		memmove(ctx->paste_buffer,
+		        ctx->paste_buffer + ctx->paste_delivered,
+		        ctx->paste_length);
+		ctx->paste_delivered = 0;
+	}
+
+	char *b = ctx->paste_buffer, *p = b + ctx->paste_searched;
+	char *end = b + ctx->paste_length;
+	size_t m = ctx->paste_end_length;
+	while ((p = memchr(p, ctx->paste_end[0], end - p))) {
+		if ((size_t)(end - p) < m)
+			break;
+		if (!memcmp(p, ctx->paste_end, m)) {
+			/* too long for one event, the part before goes first */
+			if (p - b > MAX_PASTE)
+				break;
+			memset(event, 0, sizeof(jx_event));
+			event->type = JX_EVENT_PASTE;
+			event->text = b;
+			event->length = p - b;
+			ctx->spill_offset = p - b + m;
+			ctx->spill_length = end - p - m;
+			ctx->pasting = false;
+			ctx->stats.pastes++;
+			ctx->stats.paste_bytes += event->length;
+			return true;
+		}
+		p++;
+	}
+	/* the end marker may be split across reads */
+	ctx->paste_searched = p ? (size_t)(p - b) : ctx->paste_length;
+	if (ctx->paste_length < MAX_PASTE)
+		return false;
+
+	/* give out what cannot be the end marker and read on */
+	memset(event, 0, sizeof(jx_event));
+	event->type = JX_EVENT_PASTE;
+	event->mod = JX_MOD_CONTINUED;
+	event->text = b;
+	event->length = MIN(ctx->paste_searched, MAX_PASTE);
+	ctx->paste_delivered = event->length;
+	ctx->stats.paste_bytes += event->length;
+	return true;
+}
+
+/* drop decoded input from the front of the input buffer */
+static void consume_input(jx_context *ctx, int l)
+{
+	ctx->IN_index -= l;
+	memmove(ctx->IN, ctx->IN + l, ctx->IN_index);
+	ctx->escape_held = 0;
+}
+
+/* merge the motion reports that follow into the latest position, as long
+ * as the buttons and modifiers stay the same */
+static void coalesce_motion(jx_context *ctx, jx_event *event)
+{
+	jx_event next;
+	for (;;) {
+		int l = ctx->IN_index ? decode_event(ctx, &next, false) : 0;
+		if (!l) {
+			/* take what has arrived since, without waiting */
+			struct pollfd fd = { ctx->tty, POLLIN, 0 };
+			if (ctx->IN_index == MAX_INPUT_BUFFER ||
+			    poll(&fd, 1, 0) <= 0 || read_input(ctx) <= 0)
+				return;
+			continue;
+		}
+		if (next.type != JX_EVENT_MOUSE || next.key != event->key ||
+		    next.mod != event->mod)
+			return;
+		*event = next;
+		consume_input(ctx, l);
+		ctx->stats.events_coalesced++;
+	}
+}
+
+/* wait up to timeout milliseconds for an event, forever if negative */
+int jx_peek(jx_event *event, int timeout)
+{
+	jx_context *ctx = current;
+	bool force = false, polled = false;
+	if (!ctx)
+		return -1;
+	/* the timeout holds however many reads partial input takes */
+	uint64_t deadline = clock_ns() + (uint64_t)MAX(timeout, 0) * 1000000;
+
+	for (;;) {
+		if (ctx->pasting) {
+			if (end_paste(ctx, event)) {
+				ctx->stats.events_decoded++;
+				return event->type;
+			}
+		} else if (ctx->IN_index) {
+			/* input that has already arrived */
+			int l = decode_event(ctx, event, force);
+			if (l) {
+				consume_input(ctx, l);
+				if (event->type == JX_EVENT_PASTE) {
+					if (begin_paste(ctx))
+						return -1;
+					continue;
+				}
+				if (event->type == JX_EVENT_MOUSE &&
+				    event->mod & JX_MOD_MOTION)
+					coalesce_motion(ctx, event);
+				ctx->stats.events_decoded++;
+				return event->type;
+			}
+		}
+		/* input left over from a paste */
+		if (ctx->spill_length && ctx->IN_index < MAX_INPUT_BUFFER) {
+			read_input(ctx);
+			continue;
+		}
+
+		uint64_t now = clock_ns();
+		int wait = -1;
+		if (timeout >= 0) {
+			if (polled && now >= deadline)
+				return 0;
+			wait = now < deadline ?
+				(deadline - now + 999999) / 1000000 : 0;
+		}
+
+		/* an escape that may start a longer sequence waits a little
+		 * for the rest, then goes as it is */
+		bool held = false;
+		if (!ctx->pasting && ctx->IN_index && ctx->IN[0] == '\033' &&
+		    !force) {
+			if (!ctx->escape_held)
+				ctx->escape_held = now;
+			int64_t left = ESCAPE_TIMEOUT -
+				(int64_t)(now - ctx->escape_held) / 1000000;
+			if (left <= 0) {
+				force = true;
+				continue;
+			}
+			if (wait < 0 || wait > left) {
+				wait = left;
+				held = true;
+			}
+		}
+
+		struct pollfd fds[2] = {
+			{ ctx->tty, POLLIN, 0 },
+			{ ctx->winch_fds[0], POLLIN, 0 }
+		};
+		int n = poll(fds, 2, wait);
+		polled = true;
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n < 0 || (!n && !held))
+			return n;
+
+		/* a size change from the signal handler */
+		if (fds[1].revents & POLLIN) {
+			int ret;
+			unsigned short lines, columns;
+			read(ctx->winch_fds[0], &ret, sizeof(int));
+			read(ctx->winch_fds[0], &lines, sizeof(unsigned short));
+			read(ctx->winch_fds[0], &columns, sizeof(unsigned short));
+			if (ret == -1)
+				continue;
+			jx_resize(ctx->window_head, columns, lines);
+			jx_layout();
+			memset(event, 0, sizeof(jx_event));
+			event->type = JX_EVENT_RESIZE;
+			event->w = columns;
+			event->h = lines;
+			ctx->stats.resizes++;
+			ctx->stats.events_decoded++;
+			return event->type;
+		}
+
+		/* the other end of the terminal has gone, which poll reports
+		 * without input and read as the end of the file */
+		if (fds[0].revents & (POLLHUP | POLLERR | POLLNVAL) &&
+		    !(fds[0].revents & POLLIN)) {
+			last_error = JX_ERR_HANGUP;
+			return -1;
+		}
+		if (fds[0].revents & POLLIN &&
+		    (ctx->pasting || ctx->IN_index < MAX_INPUT_BUFFER)) {
+			int r = ctx->pasting ? read_paste(ctx) : read_input(ctx);
+			if (!r || (r < 0 && errno == EIO)) {
+				last_error = JX_ERR_HANGUP;
+				return -1;
+			}
+			if (r < 0 && errno != EINTR)
+				return -1;
+		}
+	}
+}
+
+/* wait for an event */
+int jx_poll(jx_event *event)
+{
+	return jx_peek(event, -1);
+}
+
+/* counters of what the library has been doing */
+const jx_stats *jx_statistics()
+{
+	return current ? &current->stats : NULL;
+}
+
+/* start counting again from zero */
+void jx_reset_statistics()
+{
+	if (current)
+		memset(&current->stats, 0, sizeof(jx_stats));
+}
+
+/* call a function after each frame has been rendered */
+void jx_set_frame_hook(jx_frame_hook hook, void *data)
+{
+	if (!current)
+		return;
+	current->frame_hook = hook;
+	current->frame_hook_data = data;
+}
+
+/* the last error from a call that could not return one */
+int jx_last_error()
+{
+	return last_error;
 }
@@ -2,11 +2,58 @@
 #ifndef JINXES_H
 #define JINXES_H
 
+#include <pthread.h>
 #include <stdint.h>
 #include <wchar.h>
 
 /* input modifier */
 #define JX_MOD_ALT	0x01
+#define JX_MOD_SHIFT	0x02
+#define JX_MOD_CTRL	0x04
+#define JX_MOD_MOTION	0x08
+/* a mouse button let go of, with the button as the key */
+#define JX_MOD_RELEASE	0x10
+/* a paste longer than MAX_PASTE that goes on in the next event */
+#define JX_MOD_CONTINUED	0x20
+
+/* event types */
+#define JX_EVENT_KEY	0x01
+#define JX_EVENT_RESIZE	0x02
+#define JX_EVENT_MOUSE	0x03
+#define JX_EVENT_PASTE	0x04
+
+/* special keys, in the order of the key capabilities of the terminfo */
+#define JX_KEY_F1	(0xffff - 0)
+#define JX_KEY_F2	(0xffff - 1)
+#define JX_KEY_F3	(0xffff - 2)
+#define JX_KEY_F4	(0xffff - 3)
+#define JX_KEY_F5	(0xffff - 4)
+#define JX_KEY_F6	(0xffff - 5)
+#define JX_KEY_F7	(0xffff - 6)
+#define JX_KEY_F8	(0xffff - 7)
+#define JX_KEY_F9	(0xffff - 8)
+#define JX_KEY_F10	(0xffff - 9)
+#define JX_KEY_F11	(0xffff - 10)
+#define JX_KEY_F12	(0xffff - 11)
+#define JX_KEY_INSERT	(0xffff - 12)
+#define JX_KEY_DELETE	(0xffff - 13)
+#define JX_KEY_HOME	(0xffff - 14)
+#define JX_KEY_END	(0xffff - 15)
+#define JX_KEY_PGUP	(0xffff - 16)
+#define JX_KEY_PGDN	(0xffff - 17)
+#define JX_KEY_UP	(0xffff - 18)
+#define JX_KEY_DOWN	(0xffff - 19)
+#define JX_KEY_LEFT	(0xffff - 20)
+#define JX_KEY_RIGHT	(0xffff - 21)
+#define JX_KEY_ESC	0x1b
+
+/* mouse buttons, the key of mouse events */
+#define JX_KEY_MOUSE_LEFT	(0xffff - 22)
+#define JX_KEY_MOUSE_MIDDLE	(0xffff - 23)
+#define JX_KEY_MOUSE_RIGHT	(0xffff - 24)
+#define JX_KEY_MOUSE_RELEASE	(0xffff - 25)
+#define JX_KEY_MOUSE_WHEEL_UP	(0xffff - 26)
+#define JX_KEY_MOUSE_WHEEL_DOWN	(0xffff - 27)
 
 /* supported colours (TODO: xterm's 256 colour support) */
 #define JX_DEFAULT	0x00
@@ -41,7 +88,8 @@ enum {
 	JX_ERR_INVALID_WINDOW,
 	JX_ERR_INVALID_PAD,
 	JX_ERR_INVALID_WINDOW_SIZE,
-	JX_ERR_INVALID_PAD_SIZE
+	JX_ERR_INVALID_PAD_SIZE,
+	JX_ERR_HANGUP
 };
 
 /* window flags */
@@ -59,6 +107,7 @@ enum {
 #define JX_WF_DOCK_TOP      (1 << 11)
 #define JX_WF_DOCK_BOTTOM   (1 << 12)
 #define JX_WF_DIRTY         (1 << 16)
+#define JX_WF_LAYOUT        (1 << 17)
 #define JX_WF_PAD           (1 << 18)
 
 typedef struct {
@@ -66,14 +115,37 @@ typedef struct {
 	uint16_t key;
 	uint32_t ch;
 	int32_t w, h;
+	int32_t x, y;
+	/* pasted text, valid until the next event is asked for */
+	const char *text;
+	size_t length;
 } jx_event;
 
+/* a character and its colours, zero colours take the window's */
+typedef struct {
+	wchar_t ch;
+	uint16_t fg, bg;
+} jx_cell;
+
+/* a run of utf-8 text in one set of colours */
+typedef struct {
+	const char *text;
+	uint16_t fg, bg;
+} jx_span;
+
+/* the state of one terminal, see jx_open */
+typedef struct jx_context_s jx_context;
+
 typedef struct jx_window_s {
 	/* settings */
 	int x, y, w, h;
 	int ax, ay, aw, ah;
 	int px, py, pw, ph;
 	int flags;
+	/* layout, the area docked children leave free and the last pass that
+	 * laid out the children */
+	int lx, ly, lw, lh;
+	unsigned int layout_pass;
 	/* state */
 	uint16_t fg, bg;
 	wchar_t *buffer_text;
@@ -83,20 +155,63 @@ typedef struct jx_window_s {
 	struct jx_window_s *prev, *next;
 	/* hierarchy */
 	struct jx_window_s *parent;
+	jx_context *context;
+	/* held while the window is drawn into or copied for rendering */
+	pthread_mutex_t lock;
+	struct jx_snapshot_s *snapshot;
 } jx_window;
 
+/* runtime counters, latency histogram bucket i counts [2^i, 2^(i+1)) ns */
+#define JX_HISTOGRAM_BUCKETS 32
+
+typedef struct {
+	/* rendering */
+	uint64_t frames_rendered, frames_skipped;
+	uint64_t cells_diffed, cells_emitted;
+	/* output */
+	uint64_t bytes_written, write_calls, short_writes;
+	/* input */
+	uint64_t events_decoded, events_coalesced, resizes;
+	uint64_t pastes, paste_bytes;
+	/* memory */
+	uint64_t windows_allocated, buffers_allocated;
+	/* the most recently rendered frame */
+	uint64_t frame_ns, frame_bytes, frame_cells;
+	/* latency */
+	uint64_t render_ns[JX_HISTOGRAM_BUCKETS];
+	uint64_t flush_ns[JX_HISTOGRAM_BUCKETS];
+} jx_stats;
+
+typedef void (*jx_frame_hook)(const jx_stats *stats, void *data);
+
 #define JX_SCREEN (jx_screen())
 
 int jx_initialise();
 #define jx_initialize jx_initialise
+int jx_initialise_fd(int fd);
+#define jx_initialize_fd jx_initialise_fd
 
 void jx_terminate();
 
+/* terminal is the terminal type, NULL for $TERM, so that a process serving
+ * many terminals never has to change its environment */
+jx_context *jx_open(int fd, const char *terminal);
+void jx_close(jx_context *ctx);
+void jx_select(jx_context *ctx);
+jx_context *jx_selected();
+
 int jx_set_terminal(const char *terminal);
 
 int jx_columns();
 int jx_lines();
 
+/*
+ * Windows can be created, drawn into and changed from any thread, drawing
+ * into different windows happens in parallel. Rendering, the cursor and
+ * events belong to a single thread per context, which never waits on
+ * drawing beyond the copy of each window and drawing never waits on the
+ * terminal.
+ */
 jx_window *jx_screen();
 jx_window *jx_create_window(jx_window *parent, int x, int y, int w, int h, int flags);
 int jx_destroy_window(jx_window *w);
@@ -107,20 +222,50 @@ int jx_resize(jx_window *win, int w, int h);
 int jx_scroll_pad(jx_window *w, int px, int py);
 int jx_resize_pad(jx_window *w, int pw, int ph);
 
+/*
+ * Windows created with, or given, layout flags are placed by jx_layout
+ * within their parent, using ax, ay, aw and ah as the position and size.
+ * JX_WF_RELATIVE_* make them percentages of the parent's size. With one of
+ * JX_WF_ANCHOR_RIGHT/BOTTOM ax/ay are the distance from the right/bottom
+ * and with both anchors aw/ah are the distance from the right/bottom, so
+ * the window stretches, always within the whole parent. Docked windows
+ * take aw columns or ah lines off the parent in the order they were
+ * created and JX_WF_AUTOSIZE fills what is left. Only children of windows
+ * that changed size or had children change are laid out again.
+ */
+int jx_set_layout(jx_window *w, int flags, int ax, int ay, int aw, int ah);
+
 void jx_foreground(jx_window *w, uint16_t fg);
 void jx_background(jx_window *w, uint16_t bg);
 int jx_putc(jx_window *w, int x, int y, wchar_t ch);
 int jx_write(jx_window *win, int x, int y, int w, int h, const char *text);
+int jx_write_spans(jx_window *win, int x, int y, int w, int h,
+		const jx_span *spans, int count);
+int jx_fill(jx_window *win, int x, int y, int w, int h, jx_cell cell);
+int jx_blit(jx_window *win, int x, int y, int w, int h,
+		const jx_cell *cells, int stride);
 int jx_clear(jx_window *w);
 
 int jx_layout();
 void jx_render();
+/* output a non-blocking terminal could not take is queued, frames are
+ * skipped until jx_flush has sent it, so poll for POLLOUT while it
+ * returns more than zero */
+int jx_flush();
 
 void jx_cursor(int cx, int cy);
+int jx_set_mouse(int enable);
+int jx_set_paste(int enable);
 
+/* the event type, zero on a timeout or -1 on an error, with
+ * jx_last_error giving JX_ERR_HANGUP once the terminal has gone */
 int jx_peek(jx_event *event, int timeout);
 int jx_poll(jx_event *event);
 
+const jx_stats *jx_statistics();
+void jx_reset_statistics();
+void jx_set_frame_hook(jx_frame_hook hook, void *data);
+
 uint32_t jx_version();
 const char *jx_error(int e);
 int jx_last_error();
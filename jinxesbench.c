@@ -0,0 +1,304 @@
+/* See LICENSE file for copyright and license details. */
+
+#define _XOPEN_SOURCE 600
+#include "jinxes.h"
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BENCH_COLUMNS 160
+#define BENCH_LINES 48
+#define BENCH_FRAMES 500
+#define BENCH_WINDOWS 32
+
+static const char *default_terms[] = {
+	"xterm", "xterm-256color", "screen", "rxvt", "linux", "st-256color", NULL
+};
+
+/* a pseudo terminal standing in for the user's terminal */
+static int master, slave;
+
+static uint32_t seed;
+
+/* xorshift, so every run draws exactly the same frames */
+static uint32_t rnd()
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	return seed;
+}
+
+static uint64_t now()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/* swallow everything the library sends so that it never blocks, leaving
+ * SIGWINCH to the thread taking the events */
+static void *drain(void *arg)
+{
+	char buf[4096];
+	sigset_t winch;
+	(void)arg;
+	sigemptyset(&winch);
+	sigaddset(&winch, SIGWINCH);
+	pthread_sigmask(SIG_BLOCK, &winch, NULL);
+	while (read(master, buf, sizeof(buf)) > 0);
+	return NULL;
+}
+
+/* colour the cell itself, recolouring the window would redraw all of it */
+static void random_cell(jx_window *w, int x, int y)
+{
+	jx_cell c;
+	c.fg = (1 + rnd() % 8) | (rnd() & JX_BOLD);
+	c.bg = rnd() % 9;
+	c.ch = 0x21 + rnd() % 94;
+	jx_fill(w, x, y, 1, 1, c);
+}
+
+/* every cell of the screen changes every frame */
+static void churn(int frame)
+{
+	(void)frame;
+	for (int y = 0; y < jx_lines(); y++)
+		for (int x = 0; x < jx_columns(); x++)
+			random_cell(JX_SCREEN, x, y);
+}
+
+/* the same, drawn a frame at a time from an array of cells */
+static void churn_blit(int frame)
+{
+	static jx_cell cells[BENCH_LINES * BENCH_COLUMNS];
+	int w = jx_columns(), h = jx_lines();
+	(void)frame;
+	for (int i = 0; i < w * h; i++) {
+		cells[i].fg = (1 + rnd() % 8) | (rnd() & JX_BOLD);
+		cells[i].bg = rnd() % 9;
+		cells[i].ch = 0x21 + rnd() % 94;
+	}
+	jx_blit(JX_SCREEN, 0, 0, w, h, cells, w);
+}
+
+/* a log being followed, everything moves up a line every frame */
+static void scroll_log(int frame)
+{
+	static char lines[BENCH_LINES][BENCH_COLUMNS + 1];
+	int h = jx_lines();
+	memmove(lines, lines[1], (BENCH_LINES - 1) * sizeof(lines[0]));
+	snprintf(lines[BENCH_LINES - 1], sizeof(lines[0]),
+	         "%08d %08x request served in %uus by worker %u",
+	         frame, rnd(), rnd() % 100000, rnd() % 64);
+	for (int y = 0; y < h; y++) {
+		for (int x = 0; x < jx_columns(); x++)
+			jx_putc(JX_SCREEN, x, y, ' ');
+		if (lines[BENCH_LINES - h + y][0])
+			jx_write(JX_SCREEN, 0, y, jx_columns(), 1,
+			         lines[BENCH_LINES - h + y]);
+	}
+}
+
+/* one cell in a hundred changes every frame */
+static void sparse(int frame)
+{
+	int cells = jx_columns() * jx_lines();
+	(void)frame;
+	for (int i = 0; i < cells / 100; i++) {
+		int c = rnd() % cells;
+		random_cell(JX_SCREEN, c % jx_columns(), c / jx_columns());
+	}
+}
+
+/* overlapping windows being dragged around */
+static jx_window *windows[BENCH_WINDOWS];
+static int dx[BENCH_WINDOWS], dy[BENCH_WINDOWS];
+
+static void drag_setup()
+{
+	for (int i = 0; i < BENCH_WINDOWS; i++) {
+		jx_window *w = windows[i] = jx_create_window(JX_SCREEN,
+			rnd() % (BENCH_COLUMNS - 30), rnd() % (BENCH_LINES - 10),
+			30, 10, 0);
+		for (int y = 0; y < 10; y++)
+			for (int x = 0; x < 30; x++)
+				random_cell(w, x, y);
+		dx[i] = rnd() % 2 ? 1 : -1;
+		dy[i] = rnd() % 2 ? 1 : -1;
+	}
+}
+
+static void drag(int frame)
+{
+	(void)frame;
+	for (int i = 0; i < BENCH_WINDOWS; i++) {
+		jx_window *w = windows[i];
+		if (w->x + dx[i] < 0 || w->x + dx[i] + w->w > jx_columns())
+			dx[i] = -dx[i];
+		if (w->y + dy[i] < 0 || w->y + dy[i] + w->h > jx_lines())
+			dy[i] = -dy[i];
+		jx_move(w, w->x + dx[i], w->y + dy[i]);
+	}
+}
+
+static void drag_teardown()
+{
+	for (int i = 0; i < BENCH_WINDOWS; i++)
+		jx_destroy_window(windows[i]);
+}
+
+/* resize the terminal as its user would, and wait for the SIGWINCH to come
+ * back as an event */
+static void resize_pty(int w, int h)
+{
+	struct winsize ws = { h, w, 0, 0 };
+	jx_event e;
+	if (w == jx_columns() && h == jx_lines())
+		return;
+	ioctl(master, TIOCSWINSZ, &ws);
+	while (jx_peek(&e, 1000) > 0 &&
+	       (e.type != JX_EVENT_RESIZE || e.w != w || e.h != h));
+}
+
+/* the terminal being resized as fast as it can */
+static void resize_storm(int frame)
+{
+	int w = BENCH_COLUMNS / 2 + rnd() % (BENCH_COLUMNS / 2);
+	int h = BENCH_LINES / 2 + rnd() % (BENCH_LINES / 2);
+	resize_pty(w, h);
+	if (frame % 8 == 0)
+		sparse(frame);
+}
+
+static void resize_teardown()
+{
+	resize_pty(BENCH_COLUMNS, BENCH_LINES);
+}
+
+static const struct {
+	const char *name;
+	void (*setup)();
+	void (*frame)(int);
+	void (*teardown)();
+} workloads[] = {
+	{ "churn", NULL, churn, NULL },
+	{ "blit", NULL, churn_blit, NULL },
+	{ "scroll", NULL, scroll_log, NULL },
+	{ "sparse", NULL, sparse, NULL },
+	{ "drag", drag_setup, drag, drag_teardown },
+	{ "resize", NULL, resize_storm, resize_teardown },
+};
+
+/* the pty is the controlling terminal of the workload's own session, so
+ * that resizing it raises SIGWINCH */
+static int open_pty()
+{
+	struct winsize ws = { BENCH_LINES, BENCH_COLUMNS, 0, 0 };
+	if ((master = posix_openpt(O_RDWR | O_NOCTTY)) < 0 ||
+	    grantpt(master) || unlockpt(master) ||
+	    (slave = open(ptsname(master), O_RDWR | O_NOCTTY)) < 0 ||
+	    setsid() < 0 || ioctl(slave, TIOCSCTTY, 0))
+		return -1;
+	return ioctl(master, TIOCSWINSZ, &ws);
+}
+
+/* run one workload on a fresh terminal, in its own process so that the
+ * peak memory is that of the workload alone */
+static int run(const char *term, size_t i)
+{
+	pthread_t drainer;
+	const jx_stats *st;
+	uint64_t t, bytes, writes, elapsed = 0;
+	struct rusage ru;
+	int err;
+
+	if (open_pty()) {
+		perror("pty");
+		return 1;
+	}
+	setenv("TERM", term, 1);
+	if ((err = jx_initialise_fd(slave))) {
+		fprintf(stderr, "%s: %s\n", term, jx_error(err));
+		return 1;
+	}
+	pthread_create(&drainer, NULL, drain, NULL);
+	st = jx_statistics();
+
+	seed = 2463534242u;
+	jx_clear(JX_SCREEN);
+	jx_render();
+	if (workloads[i].setup)
+		workloads[i].setup();
+	jx_render();
+
+	bytes = st->bytes_written;
+	writes = st->write_calls;
+	for (int f = 0; f < BENCH_FRAMES; f++) {
+		t = now();
+		workloads[i].frame(f);
+		jx_render();
+		elapsed += now() - t;
+	}
+	bytes = st->bytes_written - bytes;
+	writes = st->write_calls - writes;
+
+	if (workloads[i].teardown)
+		workloads[i].teardown();
+	getrusage(RUSAGE_SELF, &ru);
+	printf("%-16s %-8s %10lu %12.1f %10.2f %10ld\n", term,
+	       workloads[i].name,
+	       (unsigned long)(elapsed / BENCH_FRAMES),
+	       (double)bytes / BENCH_FRAMES,
+	       (double)writes / BENCH_FRAMES,
+	       ru.ru_maxrss);
+	fflush(stdout);
+
+	/* the drain thread sees the end of the terminal once the slave closes */
+	jx_terminate();
+	pthread_join(drainer, NULL);
+	/* closing the terminal hangs up the session it controls */
+	signal(SIGHUP, SIG_IGN);
+	close(master);
+	return 0;
+}
+
+static int bench(const char *term)
+{
+	for (size_t i = 0; i < sizeof(workloads) / sizeof(*workloads); i++) {
+		int status;
+		pid_t pid = fork();
+		if (pid < 0) {
+			perror("fork");
+			return 1;
+		}
+		if (!pid)
+			_exit(run(term, i));
+		if (waitpid(pid, &status, 0) < 0 ||
+		    !WIFEXITED(status) || WEXITSTATUS(status))
+			return 1;
+	}
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	const char **terms = argc > 1 ? (const char **)argv + 1 : default_terms;
+
+	printf("%-16s %-8s %10s %12s %10s %10s\n", "terminal", "workload",
+	       "ns/frame", "bytes/frame", "writes", "maxrss_kb");
+	fflush(stdout);
+	for (; *terms; terms++)
+		if (bench(*terms))
+			return 1;
+	return 0;
+}
@@ -1,10 +1,25 @@
 /* See LICENSE file for copyright and license details. */
 
+#define _XOPEN_SOURCE 700
 #include "jinxes.h"
+#include "config.h"
+#include <fcntl.h>
+#include <poll.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
 
 #define TEST_LOG "jinxestest.log"
+/* the terminal the pseudo terminals are opened as */
+#ifdef JX_TERMINAL
+#define TEST_TERMINAL JX_TERMINAL
+#else
+#define TEST_TERMINAL "xterm"
+#endif
 #define TEST_ASSERT(f,a,c) ftest(#a " " #c, a, a c, f);
 
 void ftest(const char *s, int value, int pass, FILE *f)
@@ -12,16 +27,481 @@ void ftest(const char *s, int value, int pass, FILE *f)
 	fprintf(f, "%s...%d\t%s\n", s, value, pass ? "PASS" : "FAIL");
 }
 
+/* a pseudo terminal to type into, the library gets the slave */
+static int master = -1, slave = -1;
+
+static jx_context *open_pty(const char *term)
+{
+	struct winsize ws = { 24, 80, 0, 0 };
+	if ((master = posix_openpt(O_RDWR | O_NOCTTY)) < 0 ||
+	    grantpt(master) || unlockpt(master) ||
+	    (slave = open(ptsname(master), O_RDWR | O_NOCTTY)) < 0 ||
+	    ioctl(master, TIOCSWINSZ, &ws))
+		return NULL;
+	return jx_open(slave, term);
+}
+
+/* type some input and take the next event */
+static int type(const char *s, jx_event *e)
+{
+	write(master, s, strlen(s));
+	return jx_peek(e, 100);
+}
+
+/* paste a byte at a time, without the end of the paste */
+static void *trickle(void *arg)
+{
+	(void)arg;
+	for (int i = 0; i < 60; i++) {
+		poll(NULL, 0, 5);
+		write(master, "t", 1);
+	}
+	return NULL;
+}
+
+/* the text of the long paste, with its end split by MAX_PASTE */
+#define LONG_PASTE (2 * (size_t)MAX_PASTE - 3)
+#define LONG_PASTE_AT(i) (char)('a' + (i) % 26)
+
+/* paste more than fits in one event, then type after it */
+static void *long_paste(void *arg)
+{
+	/* whole turns of the alphabet, so every chunk is the same */
+	static char chunk[26 * 2048];
+	(void)arg;
+	for (size_t k = 0; k < sizeof(chunk); k++)
+		chunk[k] = LONG_PASTE_AT(k);
+	write(master, "\033[200~", 6);
+	for (size_t i = 0; i < LONG_PASTE; i += sizeof(chunk)) {
+		size_t l = LONG_PASTE - i < sizeof(chunk) ?
+			LONG_PASTE - i : sizeof(chunk);
+		for (size_t k = 0; k < l; )
+			k += write(master, chunk + k, l - k);
+	}
+	write(master, "\033[201~x\033OP", 10);
+	return NULL;
+}
+
+/* a model of the terminal, enough of one to see the frames drawn */
+static char model[24][80];
+static int model_x, model_y, model_state, model_param[2], model_params;
+
+static void model_output(const char *s, int l)
+{
+	for (int i = 0; i < l; i++) {
+		unsigned char c = s[i];
+		if (model_state == 1) {
+			/* an escape sequence, or the charset in ESC ( B */
+			model_state = c == '[' ? 2 : c == '(' || c == ')' ? 3 : 0;
+			model_param[0] = model_param[1] = model_params = 0;
+		} else if (model_state == 2) {
+			if (c >= '0' && c <= '9' && model_params < 2)
+				model_param[model_params] =
+					model_param[model_params] * 10 + c - '0';
+			else if (c == ';')
+				model_params++;
+			else if (c >= 0x40 && c <= 0x7e) {
+				if (c == 'H') {
+					model_y = model_param[0] ? model_param[0] - 1 : 0;
+					model_x = model_param[1] ? model_param[1] - 1 : 0;
+				} else if (c == 'J') {
+					memset(model, ' ', sizeof(model));
+				}
+				model_state = 0;
+			}
+		} else if (model_state == 3) {
+			model_state = 0;
+		} else if (c == 033) {
+			model_state = 1;
+		} else if (c >= ' ' && c < 0x7f) {
+			if (model_y < 24 && model_x < 80)
+				model[model_y][model_x] = c;
+			model_x++;
+		}
+	}
+}
+
+/* pass what has been rendered to the model, until the library is done */
+static void model_drain()
+{
+	char out[4096];
+	int n;
+	do {
+		while ((n = read(master, out, sizeof(out))) > 0)
+			model_output(out, n);
+	} while (jx_flush() > 0);
+	while ((n = read(master, out, sizeof(out))) > 0)
+		model_output(out, n);
+}
+
+/* windows drawn into by their own threads while another moves one about */
+#define PRODUCERS 3
+#define PRODUCED 20000
+static jx_window *produced[PRODUCERS], *roaming;
+static int producers_done;
+
+static void *producer(void *arg)
+{
+	int i = (int)(intptr_t)arg;
+	for (int k = 0; k < PRODUCED; k++) {
+		jx_cell c = { L'a' + k % 26, 1 + i, 0 };
+		jx_fill(produced[i], 0, 0, 20, 3, c);
+		jx_putc(produced[i], k % 20, k % 3, L'A' + i);
+	}
+	__atomic_add_fetch(&producers_done, 1, __ATOMIC_RELEASE);
+	return NULL;
+}
+
+static void *mover(void *arg)
+{
+	jx_cell c = { L'R', 7, 0 };
+	(void)arg;
+	for (int k = 0; k < PRODUCED; k++) {
+		jx_move(roaming, k * 7 % 70, k * 3 % 20);
+		jx_resize(roaming, 5 + k % 10, 2 + k % 4);
+		jx_fill(roaming, 0, 0, 15, 6, c);
+	}
+	jx_move(roaming, 60, 12);
+	jx_resize(roaming, 10, 4);
+	jx_fill(roaming, 0, 0, 10, 4, c);
+	__atomic_add_fetch(&producers_done, 1, __ATOMIC_RELEASE);
+	return NULL;
+}
+
+#ifndef JX_TERMINAL
+/* a build fixed to one terminal never reads the terminfo database */
+static void put16(FILE *e, int v)
+{
+	fputc(v & 0xff, e);
+	fputc(v >> 8 & 0xff, e);
+}
+
+/* write a compiled terminfo entry (see term(5)) with only clear_screen,
+ * key_f1 and the extended BE */
+static void write_entry(const char *path)
+{
+	FILE *e = fopen(path, "wb");
+	if (!e)
+		return;
+	/* the names, no booleans or numbers, strings up to key_f1 */
+	put16(e, 0432);
+	put16(e, 7);
+	put16(e, 0);
+	put16(e, 0);
+	put16(e, 67);
+	put16(e, 9);
+	fwrite("jxtest\0\0", 1, 8, e);
+	for (int i = 0; i < 67; i++)
+		put16(e, i == 5 ? 0 : i == 66 ? 4 : -1);
+	fwrite("CLS\0\033[9~\0\0", 1, 10, e);
+	/* one extended string, its offset and name then both of them */
+	put16(e, 0);
+	put16(e, 0);
+	put16(e, 1);
+	put16(e, 2);
+	put16(e, 9);
+	put16(e, 0);
+	put16(e, 0);
+	fwrite("BE-ON\0BE\0", 1, 9, e);
+	fclose(e);
+}
+
+/* what the library sent to the pseudo terminal */
+static char *sent(char *out, int size)
+{
+	int n = read(master, out, size - 1);
+	out[n > 0 ? n : 0] = '\0';
+	return out;
+}
+#endif
+
 int main(int argc, char **argv)
 {
 	FILE *f = fopen(TEST_LOG, "w+");
 	int err = JX_SUCCESS;
+	jx_event e;
+	int n;
+	char out[4096];
+#ifndef JX_TERMINAL
+	/* a terminal from the terminfo database, parsed, then from the cache
+	 * and then parsed again once the cache is cut short */
+	char dir[] = "/tmp/jxtestXXXXXX", entry[64], cache[64];
+	struct stat st;
+	if (mkdtemp(dir)) {
+		snprintf(entry, sizeof(entry), "%s/j", dir);
+		mkdir(entry, 0755);
+		snprintf(entry, sizeof(entry), "%s/j/jxtest", dir);
+		snprintf(cache, sizeof(cache), "%s/jinxes/jxtest", dir);
+		write_entry(entry);
+		setenv("TERMINFO", dir, 1);
+		setenv("XDG_CACHE_HOME", dir, 1);
+		for (int pass = 0; pass < 3; pass++) {
+			if (pass == 2 && !stat(cache, &st))
+				truncate(cache, st.st_size - 8);
+			jx_context *ctx = open_pty("jxtest");
+			TEST_ASSERT(f, !ctx, == 0);
+			if (!ctx)
+				break;
+			jx_select(ctx);
+			n = strstr(sent(out, sizeof(out)), "CLS") != NULL;
+			TEST_ASSERT(f, n, == 1);
+			jx_set_paste(1);
+			n = strcmp(sent(out, sizeof(out)), "BE-ON");
+			TEST_ASSERT(f, n, == 0);
+			n = type("\033[9~", &e);
+			TEST_ASSERT(f, e.key, == JX_KEY_F1);
+			TEST_ASSERT(f, access(cache, R_OK), == 0);
+			jx_close(ctx);
+			close(master);
+		}
+		unlink(cache);
+		unlink(entry);
+		snprintf(entry, sizeof(entry), "%s/j", dir);
+		rmdir(entry);
+		snprintf(cache, sizeof(cache), "%s/jinxes", dir);
+		rmdir(cache);
+		rmdir(dir);
+		unsetenv("TERMINFO");
+		unsetenv("XDG_CACHE_HOME");
+	}
+#endif
+	/* input decoding, typed into a pseudo terminal */
+	jx_select(open_pty(TEST_TERMINAL));
+#ifdef JX_TERMINAL
+	/* only the terminal the build was fixed to can be used */
+	n = jx_set_terminal(strcmp(JX_TERMINAL, "xterm") ? "xterm" : "vt100");
+	TEST_ASSERT(f, n, == JX_ERR_UNSUPPORTED_TERMINAL);
+	n = jx_set_terminal(JX_TERMINAL);
+	TEST_ASSERT(f, n, == JX_SUCCESS);
+#else
+	/* compiled in terminals are found by name, and a name next to one
+	 * that is in neither the build nor the database is not */
+	const char *names[] = { "xterm-256color", "screen", "linux", "rxvt" };
+	for (int i = 0; i < 4; i++) {
+		n = jx_set_terminal(names[i]);
+		TEST_ASSERT(f, n, == JX_SUCCESS);
+	}
+	n = jx_set_terminal("xterm-257color");
+	TEST_ASSERT(f, n, == JX_ERR_UNSUPPORTED_TERMINAL);
+	n = jx_set_terminal(TEST_TERMINAL);
+	TEST_ASSERT(f, n, == JX_SUCCESS);
+#endif
+	n = type("\033OP", &e);
+	TEST_ASSERT(f, n, == JX_EVENT_KEY);
+	TEST_ASSERT(f, e.key, == JX_KEY_F1);
+	n = type("\033x", &e);
+	TEST_ASSERT(f, n, == JX_EVENT_KEY);
+	TEST_ASSERT(f, (int)e.ch, == 'x');
+	TEST_ASSERT(f, e.mod, == JX_MOD_ALT);
+	n = type("\001", &e);
+	TEST_ASSERT(f, n, == JX_EVENT_KEY);
+	TEST_ASSERT(f, e.key, == 1);
+	n = type("\303", &e);
+	TEST_ASSERT(f, n, == 0);
+	n = type("\251", &e);
+	TEST_ASSERT(f, n, == JX_EVENT_KEY);
+	TEST_ASSERT(f, (int)e.ch, == 0xe9);
+	/* an escape waits for the rest of a key, or goes alone */
+	write(master, "\033O", 2);
+	/* give the pseudo terminal time to pass it on */
+	poll(NULL, 0, 10);
+	n = jx_peek(&e, 0);
+	TEST_ASSERT(f, n, == 0);
+	n = type("P", &e);
+	TEST_ASSERT(f, e.key, == JX_KEY_F1);
+	n = type("\033", &e);
+	TEST_ASSERT(f, n, == JX_EVENT_KEY);
+	TEST_ASSERT(f, e.key, == 27);
+	/* mouse reports, with motion merged into the last position */
+	jx_set_mouse(1);
+	n = type("\033[<0;5;6m", &e);
+	TEST_ASSERT(f, n, == JX_EVENT_MOUSE);
+	TEST_ASSERT(f, e.key, == JX_KEY_MOUSE_LEFT);
+	TEST_ASSERT(f, e.mod, == JX_MOD_RELEASE);
+	char reports[200 * 16];
+	int length = 0;
+	for (int i = 1; i <= 200; i++)
+		length += sprintf(reports + length, "\033[<32;%d;1M", i);
+	uint64_t coalesced = jx_statistics()->events_coalesced;
+	write(master, reports, length);
+	poll(NULL, 0, 20);
+	n = jx_peek(&e, 100);
+	TEST_ASSERT(f, n, == JX_EVENT_MOUSE);
+	TEST_ASSERT(f, e.x, == 199);
+	TEST_ASSERT(f, (int)(jx_statistics()->events_coalesced - coalesced), == 199);
+	n = jx_peek(&e, 0);
+	TEST_ASSERT(f, n, == 0);
+	/* the start of a paste is only one with paste mode on */
+	n = type("\033[200~", &e);
+	TEST_ASSERT(f, n, == JX_EVENT_KEY);
+	TEST_ASSERT(f, e.mod, == JX_MOD_ALT);
+	while (jx_peek(&e, 0) > 0);
+	/* a paste with its end split across reads, and the keys after it */
+	jx_set_paste(1);
+	write(master, "\033[200~hello\033[20", 15);
+	poll(NULL, 0, 10);
+	n = jx_peek(&e, 0);
+	TEST_ASSERT(f, n, == 0);
+	n = type("1~x\033OP", &e);
+	TEST_ASSERT(f, n, == JX_EVENT_PASTE);
+	TEST_ASSERT(f, (int)e.length, == 5);
+	TEST_ASSERT(f, memcmp(e.text, "hello", 5), == 0);
+	n = jx_peek(&e, 100);
+	TEST_ASSERT(f, (int)e.ch, == 'x');
+	n = jx_peek(&e, 100);
+	TEST_ASSERT(f, e.key, == JX_KEY_F1);
+	/* the timeout holds while partial input keeps arriving */
+	pthread_t writer;
+	struct timespec t0, t1;
+	type("\033[200~", &e);
+	pthread_create(&writer, NULL, trickle, NULL);
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	n = jx_peek(&e, 50);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	pthread_join(writer, NULL);
+	long ms = (t1.tv_sec - t0.tv_sec) * 1000 +
+		(t1.tv_nsec - t0.tv_nsec) / 1000000;
+	TEST_ASSERT(f, n, == 0);
+	TEST_ASSERT(f, (int)ms, < 200);
+	n = type("\033[201~", &e);
+	TEST_ASSERT(f, n, == JX_EVENT_PASTE);
+	TEST_ASSERT(f, (int)e.length, == 60);
+	/* a paste longer than MAX_PASTE comes in parts, the last of them
+	 * empty as the cap splits the end of the paste, and a slow pty may
+	 * not fill a part before the wait is up */
+	size_t pasted = 0;
+	int parts = 0, matched = 1, waits = 0;
+	pthread_create(&writer, NULL, long_paste, NULL);
+	while ((n = jx_peek(&e, 2000)) == JX_EVENT_PASTE ||
+	       (!n && waits++ < 30)) {
+		if (!n)
+			continue;
+		for (size_t k = 0; k < e.length && matched; k++)
+			matched = e.text[k] == LONG_PASTE_AT(pasted + k);
+		pasted += e.length;
+		parts++;
+		if (!(e.mod & JX_MOD_CONTINUED))
+			break;
+	}
+	TEST_ASSERT(f, parts, == 3);
+	TEST_ASSERT(f, (int)e.length, == 0);
+	TEST_ASSERT(f, (int)(pasted == LONG_PASTE), == 1);
+	TEST_ASSERT(f, matched, == 1);
+	n = jx_peek(&e, 100);
+	TEST_ASSERT(f, (int)e.ch, == 'x');
+	n = jx_peek(&e, 100);
+	TEST_ASSERT(f, e.key, == JX_KEY_F1);
+	pthread_join(writer, NULL);
+	jx_set_paste(0);
+	/* output a non-blocking terminal cannot take yet is kept */
+	long got = 0;
+	fcntl(slave, F_SETFL, O_NONBLOCK);
+	fcntl(master, F_SETFL, O_NONBLOCK);
+	for (int i = 0; i < 64 && jx_flush() <= 0; i++) {
+		jx_cell c = { L'a' + i % 26, 1 + i % 8, 1 + (i + 1) % 8 };
+		jx_fill(JX_SCREEN, 0, 0, jx_columns(), jx_lines(), c);
+		jx_render();
+	}
+	TEST_ASSERT(f, jx_flush(), > 0);
+	do {
+		while ((n = read(master, out, sizeof(out))) > 0)
+			got += n;
+	} while (jx_flush() > 0);
+	while ((n = read(master, out, sizeof(out))) > 0)
+		got += n;
+	TEST_ASSERT(f, got, == (long)jx_statistics()->bytes_written);
+	jx_close(jx_selected());
+	close(master);
+	/* a terminal whose other end has gone ends the wait at once */
+	jx_select(open_pty(TEST_TERMINAL));
+	close(master);
+	n = jx_peek(&e, 2000);
+	TEST_ASSERT(f, n, == -1);
+	TEST_ASSERT(f, jx_last_error(), == JX_ERR_HANGUP);
+	jx_close(jx_selected());
+	/* render while other threads draw, the last frame has it all */
+	jx_select(open_pty(TEST_TERMINAL));
+	fcntl(slave, F_SETFL, O_NONBLOCK);
+	fcntl(master, F_SETFL, O_NONBLOCK);
+	pthread_t threads[PRODUCERS + 1];
+	for (int i = 0; i < PRODUCERS; i++)
+		produced[i] = jx_create_window(JX_SCREEN, 0, i * 4, 20, 3, 0);
+	roaming = jx_create_window(JX_SCREEN, 0, 0, 5, 2, 0);
+	for (int i = 0; i < PRODUCERS; i++)
+		pthread_create(&threads[i], NULL, producer, (void *)(intptr_t)i);
+	pthread_create(&threads[PRODUCERS], NULL, mover, NULL);
+	while (__atomic_load_n(&producers_done, __ATOMIC_ACQUIRE) <= PRODUCERS) {
+		jx_render();
+		model_drain();
+	}
+	for (int i = 0; i <= PRODUCERS; i++)
+		pthread_join(threads[i], NULL);
+	jx_render();
+	model_drain();
+	int wrong = 0;
+	for (int y = 0; y < 24; y++) {
+		for (int x = 0; x < 80; x++) {
+			int i = y / 4, k = PRODUCED - 1;
+			char c = ' ';
+			if (x < 20 && y % 4 < 3 && i < PRODUCERS)
+				c = x == k % 20 && y % 4 == k % 3 ?
+					'A' + i : 'a' + k % 26;
+			else if (x >= 60 && x < 70 && y >= 12 && y < 16)
+				c = 'R';
+			wrong += model[y][x] != c;
+		}
+	}
+	TEST_ASSERT(f, wrong, == 0);
+	TEST_ASSERT(f, (int)jx_statistics()->frames_rendered, > 1);
+	jx_close(jx_selected());
+	close(master);
 	if ((err = jx_initialise())) {
 		fprintf(stderr, "%s: %s\n", argv[0], jx_error(err));
 		return 1;
 	}
 	TEST_ASSERT(f, jx_columns(), > 0);
 	TEST_ASSERT(f, jx_lines(), > 0);
+	jx_render();
+	TEST_ASSERT(f, (int)jx_statistics()->frames_rendered, == 1);
+	jx_render();
+	TEST_ASSERT(f, (int)jx_statistics()->frames_skipped, == 1);
+	jx_window *parent = jx_create_window(JX_SCREEN, 0, 0, 40, 20, 0);
+	jx_window *left = jx_create_window(parent, 0, 0, 10, 0, JX_WF_DOCK_LEFT);
+	jx_window *fill = jx_create_window(parent, 0, 0, 0, 0, JX_WF_AUTOSIZE);
+	jx_layout();
+	TEST_ASSERT(f, left->h, == 20);
+	TEST_ASSERT(f, fill->x, == 10);
+	TEST_ASSERT(f, fill->w, == 30);
+	jx_resize(parent, 60, 10);
+	jx_layout();
+	TEST_ASSERT(f, fill->w, == 50);
+	TEST_ASSERT(f, fill->h, == 10);
+	jx_destroy_window(parent);
+	/* sizes and positions are of the whole parent, not what docks left */
+	parent = jx_create_window(JX_SCREEN, 0, 0, 100, 10, 0);
+	jx_create_window(parent, 0, 0, 20, 0, JX_WF_DOCK_LEFT);
+	jx_window *half = jx_create_window(parent, 0, 0, 50, 0,
+		JX_WF_DOCK_LEFT | JX_WF_RELATIVE_W);
+	jx_window *placed = jx_create_window(parent, 10, 0, 10, 1,
+		JX_WF_ANCHOR_LEFT | JX_WF_RELATIVE_X);
+	jx_layout();
+	TEST_ASSERT(f, half->x, == 20);
+	TEST_ASSERT(f, half->w, == 50);
+	TEST_ASSERT(f, placed->x, == 10);
+	jx_destroy_window(parent);
+	jx_cell cells[4] = {{L'a', 1, 2}, {L'b', 3, 4}, {L'c', 5, 6}, {L'd', 7, 8}};
+	jx_window *bulk = jx_create_window(JX_SCREEN, 0, 0, 4, 4, 0);
+	TEST_ASSERT(f, jx_fill(bulk, 0, 0, 4, 4, cells[0]), == JX_SUCCESS);
+	TEST_ASSERT(f, bulk->buffer_text[15], == L'a');
+	TEST_ASSERT(f, jx_blit(bulk, 2, 2, 2, 2, cells, 2), == JX_SUCCESS);
+	TEST_ASSERT(f, bulk->buffer_fg[15], == 7);
+	TEST_ASSERT(f, jx_blit(bulk, 3, 3, 2, 2, cells, 2), == JX_ERR_OUT_OF_WINDOW);
+	jx_span spans[2] = {{"xy", 1, 0}, {"z", 2, 0}};
+	TEST_ASSERT(f, jx_write_spans(bulk, 0, 0, 2, 2, spans, 2), == JX_SUCCESS);
+	TEST_ASSERT(f, bulk->buffer_fg[4], == 2);
+	jx_destroy_window(bulk);
+	TEST_ASSERT(f, jx_destroy_window(bulk), == JX_ERR_INVALID_WINDOW);
+	TEST_ASSERT(f, jx_putc(bulk, 0, 0, L'a'), == JX_ERR_INVALID_WINDOW);
 	jx_terminate();
 	fclose(f);
 	return 0;
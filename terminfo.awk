@@ -1,8 +1,33 @@
 #!/usr/bin/env awk -f
 
+# the hash of terminal names, jinxes.c computes the same one at run time
+function hash(s, d,    h, i, m) {
+	h = 0
+	m = 31 + d
+	for (i = 1; i <= length(s); i++)
+		h = (h * m + ord[substr(s, i, 1)]) % 16777213
+	return h
+}
+
+# the number of bytes in a C string literal
+function clen(s,    n, i, k) {
+	n = 0
+	for (i = 1; i <= length(s); i++) {
+		if (substr(s, i, 1) == "\\") {
+			if (substr(s, i + 1, 1) ~ /[0-7]/) {
+				for (k = 1; k < 3 && substr(s, i + 1 + k, 1) ~ /[0-7]/; k++);
+				i += k
+			} else
+				i++
+		}
+		n++
+	}
+	return n
+}
+
 BEGIN {
 	template = "terminfo.def.h"
-	infocmp = "infocmp -L -1 "
+	infocmp = "infocmp -L -1 -x "
         termbool = "cpp -DTERMINFO_RAW_NAMES -DTERMINFO_BOOLEAN " template
         termstrs = "cpp -DTERMINFO_RAW_NAMES -DTERMINFO_STRING " template
         termnums = "cpp -DTERMINFO_RAW_NAMES -DTERMINFO_NUMBER " template
@@ -10,12 +35,17 @@ BEGIN {
 	while ((getline < template) > 0)
 		print $0
 
+	# standard capabilities come with their ncurses index and are matched
+	# by their long name, extended ones by their exact name
 	i = 1
 	j = 1
 	while ((termstrs | getline) > 0)
 		if ($1 != "" && $1 != "#") {
-			strs[tolower($1)] = i
-			strs[i++] = tolower($1)
+			k = $2 ~ /^[0-9]+$/ ? tolower($1) : $2
+			strs[k] = i
+			enum[i] = $1
+			strs[i++] = k
+			caplist = caplist $1 " " $2 ","
 		}
 	num = i
 
@@ -24,6 +54,7 @@ BEGIN {
 		if ($1 != "" && $1 != "#") {
 			bool[tolower($1)] = i + 1
 			bool[i++] = tolower($1)
+			caplist = caplist $1 ","
 		}
 	numb = i
 
@@ -32,29 +63,30 @@ BEGIN {
 		if ($1 != "" && $1 != "#") {
 			nu[tolower($1)] = i + 1
 			nu[i++] = tolower($1)
+			caplist = caplist $1 ","
 		}
 	numn = i
 
+	for (i = 32; i < 127; i++)
+		ord[sprintf("%c", i)] = i
+
 	print "\n#ifdef TERMINFO_ESCAPE_CODES\n"
-	print "\ntypedef struct {"
-	print "\tshort location;"
-	print "\tunsigned short esc;"
-	print "} terminal_variant;"
+	# anything cached from the terminfo database goes stale with the list
+	print "#define TERMINFO_CAPABILITIES " hash(caplist, 0) "u\n"
 	FS="="
 	RS=" "
+	# every escape code is kept once in a single table of strings, with
+	# the empty string for missing capabilities at its start
 	esc = 1
-	esc8 = 1
-	esc12 = 1
+	escsize = 1
+	sets = 0
 }
 
 {
 	term = $0
 	gsub(/\n/,"",term)
-	term_ = term
-	gsub(/-/,"_",term_)
-	sub(/^9/,"_9",term_)
-	gsub(/\+/,"x",term_)
-	gsub(/\./,"_",term_)
+	if (term == "" || seen[term]++)
+		next
 	RS="\n"
 	caps = 0
 	caps_ = 0
@@ -106,28 +138,16 @@ BEGIN {
 		gsub(/\\\$/,  "\\\\$")
 		gsub(/\\$/,  "\\\\")
 		if (strs[$1]) {
-			if (esci[$2])
-				strsv[j,$1] = esci[$2]
-			else {
-				if (length($2) <= 8) {
-					tbl = 16384
-					strsv[j,$1] = esc8 + tbl
-					esci[$2] = esc8 + tbl
-					escp8[esc8] = $2
-					esc8++
-				} else if (length($2) <= 12) {
-					tbl = 32768
-					strsv[j,$1] = esc12 + tbl
-					esci[$2] = esc12 + tbl
-					escp12[esc12] = $2
-					esc12++
-				} else {
-					strsv[j,$1] = esc
-					esci[$2] = esc
-					escp[esc] = $2
-					esc++
-				}
+			# escape codes may themselves contain the separator
+			v = substr($0, length($1) + 2)
+			if (!(v in escoff)) {
+				escoff[v] = escsize
+				esclen[v] = clen(v)
+				escsize += esclen[v] + 1
+				escp[esc++] = v
 			}
+			strsv[$1] = v
+			strsp[$1] = 1
 		}
 		if (bool[$1]) {
 			if (bool[$1] <= 32) {
@@ -151,82 +171,130 @@ BEGIN {
 
 	caps = caps"u"
 
+	# the offsets and lengths of the escape codes, shared by terminals
+	# that have the same ones
+	offs = ""
+	lens = ""
 	for (i = 1; i < num; i++) {
-		if (!strsv[j,strs[i]]) strsv[j,strs[i]] = -1
-	}
-
-	strstr = ""
-	for (i = 1; i < num; i++)
-		strstr = strstr strsv[j,strs[i]]-1 (i == num - 1 ? "" : ",")
-
-	largest_sameness = -1
-	largest_j = -1
-	for (i = 1; i < j; i++) {
-		sameness[i] = 1
-		for (k = 1; k < num; k++) {
-			if (strsv[j,strs[k]] == strsv[i,strs[k]])
-				sameness[i]++;
-		}
-		if (sameness[i] > largest_sameness) {
-			largest_sameness = sameness[i]
-			largest_j = i
-		}
-	}
-
-	if (largest_sameness > (num / 2)) {
-		if (strstrdic[strstr]) {
-			terminals = terminals "{\"" term "\","strstrdic[strstr]","caps","caps_","nus",-1} /* "j - 1" */,\n"
-		} else if (largest_sameness == num) {
-			terminals = terminals "{\"" term "\","varstrdic[largest_j]","caps","caps_","nus","parent[largest_j] "} /* "j - 1" */,\n"
+		if (strsp[strs[i]]) {
+			offs = offs escoff[strsv[strs[i]]] ","
+			lens = lens esclen[strsv[strs[i]]] ","
 		} else {
-			parent[j] = largest_j - 1
-			varstrdic[j] = term_"_var"
-			varstr = ""
-			for (i = 1; i < num; i++) {
-				if (strsv[j,strs[i]] != strsv[largest_j,strs[i]])
-					varstr = varstr "{" (i - 1) "," strsv[j,strs[i]]-1 "},"
-			}
-			printf "static const terminal_variant "term_"_var[] = {"
-			printf "%s{-1,-1}", varstr
-			print "};"
-			terminals = terminals "{\"" term "\","term_"_var,"caps","caps_","nus"," (largest_j - 1) "} /* "j - 1" */,\n"
+			offs = offs "0,"
+			lens = lens "0,"
 		}
-	} else {
-		#if (!strstrdic[strstr]) {
-		strstrdic[strstr] = term_"_esc"
-		printf "static const unsigned short "term_"_esc[] = {"
-		printf "%s", strstr
-		print "};"
-		#}
-		terminals = terminals "{\"" term "\","strstrdic[strstr]","caps","caps_","nus",-1} /* "j - 1" */,\n"
+	}
+	# a terminal fixed at build time also gets its escape codes as literals
+	if (fixed && j == 1)
+		for (i = 1; i < num; i++)
+			fixedesc[i] = strsp[strs[i]] ? strsv[strs[i]] : ""
+	delete strsv
+	delete strsp
+	if (!((offs lens) in setidx)) {
+		setidx[offs lens] = sets
+		setoffs[sets] = offs
+		setlens[sets] = lens
+		sets++
 	}
 
+	name[j] = term
+	entry[j] = "{\"" term "\"," setidx[offs lens] "," caps "," caps_ "," nus "}"
 	j++
 }
 
 END {
-	for (i = 1; i < numn; i++)
-		nzero = nzero "0,"
-	print "\nstatic const char terminfo_short8_esctable[][8] = {"
-	for (i = 1; i < esc8; i++)
-		print "\""escp8[i]"\"" (i < esc8 - 1 ? "," : "") " /* " esci[escp8[i]] - 1 " */"
-	print "};"
-	print "\nstatic const char terminfo_short12_esctable[][12] = {"
-	for (i = 1; i < esc12; i++)
-		print "\""escp12[i]"\"" (i < esc12 - 1 ? "," : "") " /* " esci[escp12[i]] - 1 " */"
-	print "};"
-	print "\nstatic const char *terminfo_long_esctable[] = {"
+	nterms = j - 1
+	if (fixed && !nterms) {
+		print "terminfo.awk: no terminal to fix the build to" > "/dev/stderr"
+		exit 1
+	}
+	# with no terminals compiled in, a row of missing escape codes keeps
+	# the tables from being empty
+	if (!sets) {
+		for (i = 1; i < num; i++)
+			setoffs[0] = setlens[0] = setoffs[0] "0,"
+		sets = 1
+	}
+
+	print "static const char terminfo_strings[] ="
+	print "\"\\0\" /* 0 */"
 	for (i = 1; i < esc; i++)
-		print "\""escp[i]"\"" (i < esc - 1 ? "," : "") " /* " esci[escp[i]] - 1 " */"
+		print "\""escp[i]"\\0\" /* " escoff[escp[i]] " */"
+	print ";"
+	print "\nstatic const unsigned int terminfo_offsets[][TS_MAX] = {"
+	for (i = 0; i < sets; i++)
+		print "{" setoffs[i] "},"
 	print "};"
+	print "\nstatic const unsigned short terminfo_lengths[][TS_MAX] = {"
+	for (i = 0; i < sets; i++)
+		print "{" setlens[i] "},"
+	print "};"
+
 	print "\ntypedef struct {"
 	print "\tconst char *name;"
-	print "\tconst void *esc;"
+	print "\tunsigned short esc;"
 	print "\tunsigned int caps;"
 	print "\tunsigned char caps_;"
 	print "\tshort capsn[TN_MAX];"
-	print "\tshort parent;"
 	print "} terminal_map;\n"
-	printf "static terminal_map terminals[] = {\n%s{NULL,NULL,0,0,{"nzero"},-1}\n};\n", terminals
+
+	if (fixed) {
+		print "#define TERMINAL_NAME \"" name[1] "\""
+		for (i = 1; i < num; i++)
+			print "#define TS_" enum[i] "_STR \"" fixedesc[i] "\""
+		print "\nstatic const terminal_map fixed_terminal = " entry[1] ";"
+		print "\n#endif"
+		exit
+	}
+
+	print "#define TERMINAL_COUNT " nterms
+	if (!nterms) {
+		print "\n#endif"
+		exit
+	}
+
+	# a minimal perfect hash of the names: each bucket of names keeps
+	# trying a different hash until all of them land in free slots
+	buckets = int(nterms / 2) + 1
+	largest = 0
+	for (i = 1; i <= nterms; i++) {
+		b = hash(name[i], 0) % buckets
+		members[b, ++size[b]] = i
+		if (size[b] > largest)
+			largest = size[b]
+	}
+	for (s = largest; s > 0; s--) {
+		for (b = 0; b < buckets; b++) {
+			if (size[b] != s)
+				continue
+			for (d = 1; d < 65536; d++) {
+				for (k = 1; k <= s; k++) {
+					h = hash(name[members[b, k]], d) % nterms
+					if ((h in slot) || tried[h] == d)
+						break
+					tried[h] = d
+				}
+				if (k > s)
+					break
+			}
+			if (d == 65536) {
+				print "terminfo.awk: no perfect hash for the terminals" > "/dev/stderr"
+				exit 1
+			}
+			displacement[b] = d
+			for (k = 1; k <= s; k++)
+				slot[hash(name[members[b, k]], d) % nterms] = members[b, k]
+		}
+	}
+
+	print "#define TERMINAL_BUCKETS " buckets
+	print "\nstatic const unsigned short terminal_displacement[] = {"
+	for (b = 0; b < buckets; b++)
+		printf "%d%s", displacement[b], (b < buckets - 1 ? "," : "\n")
+	print "};"
+	print "\nstatic const terminal_map terminals[] = {"
+	for (i = 0; i < nterms; i++)
+		print entry[slot[i]] (i < nterms - 1 ? "," : "") " /* " i " */"
+	print "};"
 	print "\n#endif"
 }
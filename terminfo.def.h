@@ -3,6 +3,7 @@
 #undef ENTRY_BOOLEAN
 #undef ENTRY_NUMBER
 #undef ENTRY_STRING
+#undef ENTRY_EXTENDED
 
 #ifdef TERMINFO_ENUM
 #ifdef TERMINFO_BOOLEAN
@@ -13,6 +14,7 @@
 #endif
 #ifdef TERMINFO_STRING
 #define ENTRY_STRING(x,i) TS_ ## x ,
+#define ENTRY_EXTENDED(x,n) TS_ ## x ,
 #endif
 #endif
 #ifdef TERMINFO_RAW_NAMES
@@ -23,7 +25,8 @@
 #define ENTRY_NUMBER(x,i) x
 #endif
 #ifdef TERMINFO_STRING
-#define ENTRY_STRING(x,i) x
+#define ENTRY_STRING(x,i) x i
+#define ENTRY_EXTENDED(x,n) x n
 #endif
 #endif
 #ifdef TERMINFO_MAP
@@ -32,6 +35,13 @@
 #endif
 #ifdef TERMINFO_STRING
 #define ENTRY_STRING(x,i) i,
+#define ENTRY_EXTENDED(x,n) -1,
+#endif
+#endif
+#ifdef TERMINFO_EXTENDED
+#ifdef TERMINFO_STRING
+#define ENTRY_STRING(x,i) 0,
+#define ENTRY_EXTENDED(x,n) #n,
 #endif
 #endif
 #ifndef TERMINFO_BOOLEAN
@@ -42,6 +52,7 @@
 #endif
 #ifndef TERMINFO_STRING
 #define ENTRY_STRING(x,i)
+#define ENTRY_EXTENDED(x,n)
 #endif
 
 /* supported terminal extensions */
@@ -124,9 +135,13 @@ typedef enum {
 #ifdef TERMINFO_MAP
 static int terminfo_map_string[] = {
 #endif
+#ifdef TERMINFO_EXTENDED
+static const char *terminfo_map_extended[] = {
+#endif
 
 /* functions */
 ENTRY_STRING(CLEAR_SCREEN        ,5 )
+ENTRY_STRING(CURSOR_ADDRESS      ,10)
 ENTRY_STRING(CURSOR_INVISIBLE    ,13)
 ENTRY_STRING(CURSOR_NORMAL       ,16)
 ENTRY_STRING(ENTER_BLINK_MODE    ,26)
@@ -138,6 +153,8 @@ ENTRY_STRING(EXIT_ATTRIBUTE_MODE ,39)
 ENTRY_STRING(EXIT_CA_MODE        ,40)
 ENTRY_STRING(KEYPAD_LOCAL        ,88)
 ENTRY_STRING(KEYPAD_XMIT         ,89)
+ENTRY_STRING(SET_A_FOREGROUND    ,359)
+ENTRY_STRING(SET_A_BACKGROUND    ,360)
 /* keys */
 ENTRY_STRING(KEY_F1              ,66)
 ENTRY_STRING(KEY_F2              ,68)
@@ -162,6 +179,13 @@ ENTRY_STRING(KEY_DOWN            ,61)
 ENTRY_STRING(KEY_LEFT            ,79)
 ENTRY_STRING(KEY_RIGHT           ,83)
 
+/* extended, by their name in the terminfo source */
+ENTRY_EXTENDED(MOUSE_MODE        ,XM)
+ENTRY_EXTENDED(PASTE_MODE_ON     ,BE)
+ENTRY_EXTENDED(PASTE_MODE_OFF    ,BD)
+ENTRY_EXTENDED(PASTE_BEGIN       ,PS)
+ENTRY_EXTENDED(PASTE_FINISH      ,PE)
+
 #ifdef TERMINFO_ENUM
 TS_MAX
 } terminfo_string;
@@ -169,4 +193,7 @@ TS_MAX
 #ifdef TERMINFO_MAP
 };
 #endif
+#ifdef TERMINFO_EXTENDED
+};
+#endif
 #endif
@@ -0,0 +1,859 @@
+/* terminfo.h gets generated from terminfo.def.h and the terminfo database */
+
+#undef ENTRY_BOOLEAN
+#undef ENTRY_NUMBER
+#undef ENTRY_STRING
+#undef ENTRY_EXTENDED
+
+#ifdef TERMINFO_ENUM
+#ifdef TERMINFO_BOOLEAN
+#define ENTRY_BOOLEAN(x,i) TB_ ## x = i,
+#endif
+#ifdef TERMINFO_NUMBER
+#define ENTRY_NUMBER(x,i) TN_ ## x,
+#endif
+#ifdef TERMINFO_STRING
+#define ENTRY_STRING(x,i) TS_ ## x ,
+#define ENTRY_EXTENDED(x,n) TS_ ## x ,
+#endif
+#endif
+#ifdef TERMINFO_RAW_NAMES
+#ifdef TERMINFO_BOOLEAN
+#define ENTRY_BOOLEAN(x,i) x
+#endif
+#ifdef TERMINFO_NUMBER
+#define ENTRY_NUMBER(x,i) x
+#endif
+#ifdef TERMINFO_STRING
+#define ENTRY_STRING(x,i) x i
+#define ENTRY_EXTENDED(x,n) x n
+#endif
+#endif
+#ifdef TERMINFO_MAP
+#ifdef TERMINFO_NUMBER
+#define ENTRY_NUMBER(x,i) i,
+#endif
+#ifdef TERMINFO_STRING
+#define ENTRY_STRING(x,i) i,
+#define ENTRY_EXTENDED(x,n) -1,
+#endif
+#endif
+#ifdef TERMINFO_EXTENDED
+#ifdef TERMINFO_STRING
+#define ENTRY_STRING(x,i) 0,
+#define ENTRY_EXTENDED(x,n) #n,
+#endif
+#endif
+#ifndef TERMINFO_BOOLEAN
+#define ENTRY_BOOLEAN(x,i)
+#endif
+#ifndef TERMINFO_NUMBER
+#define ENTRY_NUMBER(x,i)
+#endif
+#ifndef TERMINFO_STRING
+#define ENTRY_STRING(x,i)
+#define ENTRY_EXTENDED(x,n)
+#endif
+
+/* supported terminal extensions */
+/* taken from ncurses' term.h */
+
+#ifdef TERMINFO_BOOLEAN
+#ifdef TERMINFO_ENUM
+typedef enum {
+#endif
+ENTRY_BOOLEAN(AUTO_LEFT_MARGIN, 0)
+ENTRY_BOOLEAN(AUTO_RIGHT_MARGIN, 1)
+ENTRY_BOOLEAN(NO_ESC_CTLC, 2)
+ENTRY_BOOLEAN(CEOL_STANDOUT_GLITCH, 3)
+ENTRY_BOOLEAN(EAT_NEWLINE_GLITCH, 4)
+ENTRY_BOOLEAN(ERASE_OVERSTRIKE, 5)
+ENTRY_BOOLEAN(GENERIC_TYPE, 6)
+ENTRY_BOOLEAN(HARD_COPY, 7)
+ENTRY_BOOLEAN(HAS_META_KEY, 8)
+ENTRY_BOOLEAN(HAS_STATUS_LINE, 9)
+ENTRY_BOOLEAN(INSERT_NULL_GLITCH, 10)
+ENTRY_BOOLEAN(MEMORY_ABOVE, 11)
+ENTRY_BOOLEAN(MEMORY_BELOW, 12)
+ENTRY_BOOLEAN(MOVE_INSERT_MODE, 13)
+ENTRY_BOOLEAN(MOVE_STANDOUT_MODE, 14)
+ENTRY_BOOLEAN(OVER_STRIKE, 15)
+ENTRY_BOOLEAN(STATUS_LINE_ESC_OK, 16)
+ENTRY_BOOLEAN(DEST_TABS_MAGIC_SMSO, 17)
+ENTRY_BOOLEAN(TILDE_GLITCH, 18)
+ENTRY_BOOLEAN(TRANSPARENT_UNDERLINE, 19)
+ENTRY_BOOLEAN(XON_XOFF, 20)
+ENTRY_BOOLEAN(NEEDS_XON_XOFF, 21)
+ENTRY_BOOLEAN(PRTR_SILENT, 22)
+ENTRY_BOOLEAN(HARD_CURSOR, 23)
+ENTRY_BOOLEAN(NON_REV_RMCUP, 24)
+ENTRY_BOOLEAN(NO_PAD_CHAR, 25)
+ENTRY_BOOLEAN(NON_DEST_SCROLL_REGION, 26)
+ENTRY_BOOLEAN(CAN_CHANGE, 27)
+ENTRY_BOOLEAN(BACK_COLOR_ERASE, 28)
+ENTRY_BOOLEAN(HUE_LIGHTNESS_SATURATION, 29)
+ENTRY_BOOLEAN(COL_ADDR_GLITCH, 30)
+ENTRY_BOOLEAN(CR_CANCELS_MICRO_MODE, 31)
+ENTRY_BOOLEAN(HAS_PRINT_WHEEL, 32)
+ENTRY_BOOLEAN(ROW_ADDR_GLITCH, 33)
+ENTRY_BOOLEAN(SEMI_AUTO_RIGHT_MARGIN, 34)
+ENTRY_BOOLEAN(CPI_CHANGES_RES, 35)
+ENTRY_BOOLEAN(LPI_CHANGES_RES, 36)
+#ifdef TERMINFO_ENUM
+} terminfo_boolean;
+#endif
+#endif
+
+#ifdef TERMINFO_NUMBER
+#ifdef TERMINFO_ENUM
+typedef enum {
+#endif
+#ifdef TERMINFO_MAP
+static int terminfo_map_number[] = {
+#endif
+ENTRY_NUMBER(COLUMNS, 0)
+ENTRY_NUMBER(INIT_TABS, 1)
+ENTRY_NUMBER(LINES, 2)
+ENTRY_NUMBER(LINES_OF_MEMORY, 3)
+ENTRY_NUMBER(WIDTH_STATUS_LINE, 7)
+ENTRY_NUMBER(MAX_ATTRIBUTES, 11)
+ENTRY_NUMBER(MAX_COLORS, 13)
+ENTRY_NUMBER(MAX_PAIRS, 14)
+#ifdef TERMINFO_ENUM
+TN_MAX
+} terminfo_number;
+#endif
+#ifdef TERMINFO_MAP
+};
+#endif
+#endif
+
+#ifdef TERMINFO_STRING
+#ifdef TERMINFO_ENUM
+typedef enum {
+#endif
+#ifdef TERMINFO_MAP
+static int terminfo_map_string[] = {
+#endif
+#ifdef TERMINFO_EXTENDED
+static const char *terminfo_map_extended[] = {
+#endif
+
+/* functions */
+ENTRY_STRING(CLEAR_SCREEN        ,5 )
+ENTRY_STRING(CURSOR_ADDRESS      ,10)
+ENTRY_STRING(CURSOR_INVISIBLE    ,13)
+ENTRY_STRING(CURSOR_NORMAL       ,16)
+ENTRY_STRING(ENTER_BLINK_MODE    ,26)
+ENTRY_STRING(ENTER_BOLD_MODE     ,27)
+ENTRY_STRING(ENTER_CA_MODE       ,28)
+ENTRY_STRING(ENTER_REVERSE_MODE  ,34)
+ENTRY_STRING(ENTER_UNDERLINE_MODE,36)
+ENTRY_STRING(EXIT_ATTRIBUTE_MODE ,39)
+ENTRY_STRING(EXIT_CA_MODE        ,40)
+ENTRY_STRING(KEYPAD_LOCAL        ,88)
+ENTRY_STRING(KEYPAD_XMIT         ,89)
+ENTRY_STRING(SET_A_FOREGROUND    ,359)
+ENTRY_STRING(SET_A_BACKGROUND    ,360)
+/* keys */
+ENTRY_STRING(KEY_F1              ,66)
+ENTRY_STRING(KEY_F2              ,68)
+ENTRY_STRING(KEY_F3              ,69)
+ENTRY_STRING(KEY_F4              ,70)
+ENTRY_STRING(KEY_F5              ,71)
+ENTRY_STRING(KEY_F6              ,72)
+ENTRY_STRING(KEY_F7              ,73)
+ENTRY_STRING(KEY_F8              ,74)
+ENTRY_STRING(KEY_F9              ,75)
+ENTRY_STRING(KEY_F10             ,67)
+ENTRY_STRING(KEY_F11             ,216)
+ENTRY_STRING(KEY_F12             ,217)
+ENTRY_STRING(KEY_IC              ,77)
+ENTRY_STRING(KEY_DC              ,58)
+ENTRY_STRING(KEY_HOME            ,76)
+ENTRY_STRING(KEY_END             ,164)
+ENTRY_STRING(KEY_PPAGE           ,82)
+ENTRY_STRING(KEY_NPAGE           ,81)
+ENTRY_STRING(KEY_UP              ,87)
+ENTRY_STRING(KEY_DOWN            ,61)
+ENTRY_STRING(KEY_LEFT            ,79)
+ENTRY_STRING(KEY_RIGHT           ,83)
+
+/* extended, by their name in the terminfo source */
+ENTRY_EXTENDED(MOUSE_MODE        ,XM)
+ENTRY_EXTENDED(PASTE_MODE_ON     ,BE)
+ENTRY_EXTENDED(PASTE_MODE_OFF    ,BD)
+ENTRY_EXTENDED(PASTE_BEGIN       ,PS)
+ENTRY_EXTENDED(PASTE_FINISH      ,PE)
+
+#ifdef TERMINFO_ENUM
+TS_MAX
+} terminfo_string;
+#endif
+#ifdef TERMINFO_MAP
+};
+#endif
+#ifdef TERMINFO_EXTENDED
+};
+#endif
+#endif
+
+#ifdef TERMINFO_ESCAPE_CODES
+
+#define TERMINFO_CAPABILITIES 13125044u
+
+static const char terminfo_strings[] =
+"\0" /* 0 */
+"\033[H\033[2J\0" /* 1 */
+"\033[%i%p1%d;%p2%dH\0" /* 9 */
+"\033[?25l\0" /* 26 */
+"\033[?12l\033[?25h\0" /* 33 */
+"\033[5m\0" /* 46 */
+"\033[1m\0" /* 51 */
+"\033[?1049h\033[22;0;0t\0" /* 56 */
+"\033[7m\0" /* 74 */
+"\033[4m\0" /* 79 */
+"\033(B\033[m\0" /* 84 */
+"\033[?1049l\033[23;0;0t\0" /* 91 */
+"\033[3~\0" /* 109 */
+"\033OB\0" /* 114 */
+"\033OF\0" /* 118 */
+"\033OP\0" /* 122 */
+"\033[21~\0" /* 126 */
+"\033[23~\0" /* 132 */
+"\033[24~\0" /* 138 */
+"\033OQ\0" /* 144 */
+"\033OR\0" /* 148 */
+"\033OS\0" /* 152 */
+"\033[15~\0" /* 156 */
+"\033[17~\0" /* 162 */
+"\033[18~\0" /* 168 */
+"\033[19~\0" /* 174 */
+"\033[20~\0" /* 180 */
+"\033OH\0" /* 186 */
+"\033[2~\0" /* 190 */
+"\033OD\0" /* 195 */
+"\033[6~\0" /* 199 */
+"\033[5~\0" /* 204 */
+"\033OC\0" /* 209 */
+"\033OA\0" /* 213 */
+"\033[?1l\033>\0" /* 217 */
+"\033[?1h\033=\0" /* 225 */
+"\033[%?%p1%{8}%<%t4%p1%d%e%?%p1%{16}%<%t%p1%{92}%+%d%e48\0722\072\072%p1%{65536}%/%d\072%p1%{256}%/%{255}%&%d\072%p1%{255}%&%d%;%;m\0" /* 233 */
+"\033[%?%p1%{8}%<%t3%p1%d%e%?%p1%{16}%<%t%p1%'R'%+%d%e38\0722\072\072%p1%{65536}%/%d\072%p1%{256}%/%{255}%&%d\072%p1%{255}%&%d%;%;m\0" /* 347 */
+"\033[?2004l\0" /* 460 */
+"\033[?2004h\0" /* 469 */
+"\033[201~\0" /* 478 */
+"\033[200~\0" /* 485 */
+"\033[?1006;1000%?%p1%{1}%=%th%el%;\0" /* 492 */
+"\0337\033[?47h\0" /* 524 */
+"\033[m\0" /* 533 */
+"\033[2J\033[?47l\0338\0" /* 537 */
+"\033[11~\0" /* 550 */
+"\033[12~\0" /* 556 */
+"\033[13~\0" /* 562 */
+"\033[14~\0" /* 568 */
+"\033[%?%p1%{8}%<%t4%p1%d%e%p1%{16}%<%t10%p1%{8}%-%d%e48;5;%p1%d%;m\0" /* 574 */
+"\033[%?%p1%{8}%<%t3%p1%d%e%p1%{16}%<%t9%p1%{8}%-%d%e38;5;%p1%d%;m\0" /* 638 */
+"\033H\033J\0" /* 701 */
+"\033Y%p1%' '%+%c%p2%' '%+%c\0" /* 706 */
+"\033B\0" /* 731 */
+"\033P\0" /* 734 */
+"\033Q\0" /* 737 */
+"\033R\0" /* 740 */
+"\033?t\0" /* 743 */
+"\033?u\0" /* 747 */
+"\033?v\0" /* 751 */
+"\033?w\0" /* 755 */
+"\033?x\0" /* 759 */
+"\033D\0" /* 763 */
+"\033C\0" /* 766 */
+"\033A\0" /* 769 */
+"\033[1;43m\0" /* 772 */
+"\033[7;34m\0" /* 780 */
+"\033[4;42m\0" /* 788 */
+"\033[?25h\0" /* 796 */
+"\033[?1048h\033[?1047h\0" /* 803 */
+"\033[m\017\0" /* 820 */
+"\033[?1047l\033[?1048l\0" /* 825 */
+"\033[4%p1%dm\0" /* 842 */
+"\033[3%p1%dm\0" /* 852 */
+"\177\0" /* 862 */
+"\033[?1000%?%p1%{1}%=%th%el%;\0" /* 864 */
+"\033[?1006;1004;1003%?%p1%{1}%=%th%el%;\0" /* 891 */
+"\033[?1049h\0" /* 928 */
+"\033[?1049l\0" /* 937 */
+"\033[4~\0" /* 946 */
+"\033[1~\0" /* 951 */
+"\233H\2332J\0" /* 956 */
+"\233%i%p1%d;%p2%dH\0" /* 962 */
+"\233?25l\0" /* 978 */
+"\233?25l\233?25h\0" /* 984 */
+"\2335m\0" /* 995 */
+"\2331m\0" /* 999 */
+"\233?1049h\0" /* 1003 */
+"\2337m\0" /* 1011 */
+"\2334m\0" /* 1015 */
+"\2330m\033(B\0" /* 1019 */
+"\233?1049l\0" /* 1026 */
+"\2333~\0" /* 1034 */
+"\217B\0" /* 1038 */
+"\2334~\0" /* 1041 */
+"\23311~\0" /* 1045 */
+"\23321~\0" /* 1050 */
+"\23323~\0" /* 1055 */
+"\23324~\0" /* 1060 */
+"\23312~\0" /* 1065 */
+"\23313~\0" /* 1070 */
+"\23314~\0" /* 1075 */
+"\23315~\0" /* 1080 */
+"\23317~\0" /* 1085 */
+"\23318~\0" /* 1090 */
+"\23319~\0" /* 1095 */
+"\23320~\0" /* 1100 */
+"\2331~\0" /* 1105 */
+"\2332~\0" /* 1109 */
+"\217D\0" /* 1113 */
+"\2336~\0" /* 1116 */
+"\2335~\0" /* 1120 */
+"\217C\0" /* 1124 */
+"\217A\0" /* 1127 */
+"\233?1l\033>\0" /* 1130 */
+"\233?1h\033=\0" /* 1137 */
+"\2334%p1%dm\0" /* 1144 */
+"\2333%p1%dm\0" /* 1153 */
+"\033[B\0" /* 1162 */
+"\033[F\0" /* 1166 */
+"\033[M\0" /* 1170 */
+"\033[V\0" /* 1174 */
+"\033[W\0" /* 1178 */
+"\033[X\0" /* 1182 */
+"\033[N\0" /* 1186 */
+"\033[O\0" /* 1190 */
+"\033[P\0" /* 1194 */
+"\033[Q\0" /* 1198 */
+"\033[R\0" /* 1202 */
+"\033[S\0" /* 1206 */
+"\033[T\0" /* 1210 */
+"\033[U\0" /* 1214 */
+"\033[H\0" /* 1218 */
+"\033[L\0" /* 1222 */
+"\033[D\0" /* 1226 */
+"\033[G\0" /* 1230 */
+"\033[I\0" /* 1234 */
+"\033[C\0" /* 1238 */
+"\033[A\0" /* 1242 */
+"\033[3z\0" /* 1246 */
+"\033[220z\0" /* 1251 */
+"\033[224z\0" /* 1258 */
+"\033[233z\0" /* 1265 */
+"\033[192z\0" /* 1272 */
+"\033[193z\0" /* 1279 */
+"\033[225z\0" /* 1286 */
+"\033[226z\0" /* 1293 */
+"\033[227z\0" /* 1300 */
+"\033[228z\0" /* 1307 */
+"\033[229z\0" /* 1314 */
+"\033[230z\0" /* 1321 */
+"\033[231z\0" /* 1328 */
+"\033[232z\0" /* 1335 */
+"\033[214z\0" /* 1342 */
+"\033[2z\0" /* 1349 */
+"\033[222z\0" /* 1354 */
+"\033[216z\0" /* 1361 */
+"\033@0\033[?4s\033[?4h\033@1\0" /* 1368 */
+"\033@0\033[?4r\0" /* 1385 */
+"\033[Y\0" /* 1394 */
+"\033OY\0" /* 1398 */
+"\033OZ\0" /* 1402 */
+"\033OT\0" /* 1406 */
+"\033OU\0" /* 1410 */
+"\033OV\0" /* 1414 */
+"\033OW\0" /* 1418 */
+"\033OX\0" /* 1422 */
+"\033[%?%p1%{8}%<%t4%p1%d%e48\0722\072\072%p1%{65536}%/%d\072%p1%{256}%/%{255}%&%d\072%p1%{255}%&%d%;m\0" /* 1426 */
+"\033[%?%p1%{8}%<%t3%p1%d%e38\0722\072\072%p1%{65536}%/%d\072%p1%{256}%/%{255}%&%d\072%p1%{255}%&%d%;m\0" /* 1510 */
+"\033F\0" /* 1594 */
+"\033p\0" /* 1597 */
+"\033q\0" /* 1600 */
+"\033r\0" /* 1603 */
+"\033s\0" /* 1606 */
+"\033t\0" /* 1609 */
+"\033u\0" /* 1612 */
+"\033v\0" /* 1615 */
+"\033w\0" /* 1618 */
+"\033h\0" /* 1621 */
+"\033S\0" /* 1624 */
+"\033T\0" /* 1627 */
+"\033[?1006;1004;1002%?%p1%{1}%=%th%el%;\0" /* 1630 */
+"\033[%?%p1%{8}%<%t4%p1%d%e%p1%{16}%<%t10%p1%{8}%-%d%e%?%p1%{256}%<%t48;5;%p1%d%e48\0722\072\072%p1%{65536}%/%d\072%p1%{256}%/%{255}%&%d\072%p1%{255}%&%d%;%;m\0" /* 1667 */
+"\033[%?%p1%{8}%<%t3%p1%d%e%p1%{16}%<%t9%p1%{8}%-%d%e%?%p1%{256}%<%t38;5;%p1%d%e38\0722\072\072%p1%{65536}%/%d\072%p1%{256}%/%{255}%&%d\072%p1%{255}%&%d%;%;m\0" /* 1807 */
+"\033[%?%p1%{8}%<%t%p1%'('%+%e%p1%{92}%+%;%dm\0" /* 1946 */
+"\033[%?%p1%{8}%<%t%p1%{30}%+%e%p1%'R'%+%;%dm\0" /* 1988 */
+"\033>\0" /* 2030 */
+"\033=\0" /* 2033 */
+"\033[?1005;1000%?%p1%{1}%=%th%el%;\0" /* 2036 */
+"\033[22;0;0t\0" /* 2068 */
+"\033[23;0;0t\0" /* 2078 */
+"\033[%?%p1%{8}%<%t4%p1%d%e48\0722\072%p1%{65536}%/%d\072%p1%{256}%/%{255}%&%d\072%p1%{255}%&%d%;m\0" /* 2088 */
+"\033[%?%p1%{8}%<%t3%p1%d%e38\0722\072%p1%{65536}%/%d\072%p1%{256}%/%{255}%&%d\072%p1%{255}%&%d%;m\0" /* 2171 */
+"\033[?9%?%p1%{1}%=%th%el%;\0" /* 2254 */
+"\033[0m\017\0" /* 2278 */
+"\033[[A\0" /* 2284 */
+"\033[[B\0" /* 2289 */
+"\033[[C\0" /* 2294 */
+"\033[[D\0" /* 2299 */
+"\033[[E\0" /* 2304 */
+"\033[%?%p1%{8}%<%t4%p1%d%e48;2;%p1%{65536}%/%d;%p1%{256}%/%{255}%&%d;%p1%{255}%&%d%;m\0" /* 2309 */
+"\033[%?%p1%{8}%<%t3%p1%d%e38;2;%p1%{65536}%/%d;%p1%{256}%/%{255}%&%d;%p1%{255}%&%d%;m\0" /* 2392 */
+"\033[H\033[J\0" /* 2475 */
+"\033[?2c\033[?25h\0" /* 2482 */
+"\033[33m\0" /* 2494 */
+"\033[;37m\0" /* 2500 */
+"\001\0" /* 2507 */
+"\033O[\0" /* 2509 */
+"\033[?25l\033[?1c\0" /* 2513 */
+"\033[?25h\033[?0c\0" /* 2525 */
+"\033[4%p1%{8}%m%d%?%p1%{7}%>%t;5%e;25%;m\0" /* 2537 */
+"\033[3%p1%{8}%m%d%?%p1%{7}%>%t;1%e;22%;m\0" /* 2575 */
+"\033[255;255H\033[A\033[1J\033[H\0" /* 2613 */
+"\033[0m\033(K\017\0" /* 2634 */
+"\033[0;10m\0" /* 2643 */
+"\033[34h\033[?25h\0" /* 2651 */
+"\033[0m\0" /* 2663 */
+"\033[2J\033[H\0" /* 2668 */
+"\033U\0" /* 2676 */
+"\033V\0" /* 2679 */
+"\033W\0" /* 2682 */
+"\0330I\0" /* 2685 */
+"\033H\0" /* 2689 */
+"\033E\0" /* 2692 */
+"\033f\0" /* 2695 */
+"\033. \033e\0" /* 2698 */
+"\033yA\0" /* 2704 */
+"\033v\033e\033z_\0" /* 2708 */
+"\033yH\0" /* 2716 */
+"\033z_\0" /* 2720 */
+"\033v\033. \033e\033z_\0" /* 2724 */
+"\033Y\0" /* 2735 */
+"\033X\0" /* 2738 */
+"\033I\0" /* 2741 */
+"\033b\0" /* 2744 */
+"\033a\0" /* 2747 */
+"\0" /* 2750 */
+"\033[m\033(B\0" /* 2751 */
+"\033e\0" /* 2758 */
+"\033c%?%p1%{0}%=%t1%e%p1%{1}%=%t2%e%p1%{2}%=%t3%e%p1%{3}%=%t>%e%p1%{4}%=%t4%e%p1%{5}%=%t7%e%p1%{6}%=%t5%e%p1%{7}%=%t0%e%p1%{8}%=%t8%e%p1%{9}%=%t9%e%p1%{10}%=%t\072%e%p1%{11}%=%t;%e%p1%{12}%=%t<%e%p1%{13}%=%t=%e%p1%{14}%=%t6%e?\0" /* 2761 */
+"\033b%?%p1%{0}%=%t1%e%p1%{1}%=%t2%e%p1%{2}%=%t3%e%p1%{3}%=%t>%e%p1%{4}%=%t4%e%p1%{5}%=%t7%e%p1%{6}%=%t5%e%p1%{7}%=%t0%e%p1%{8}%=%t8%e%p1%{9}%=%t9%e%p1%{10}%=%t\072%e%p1%{11}%=%t;%e%p1%{12}%=%t<%e%p1%{13}%=%t=%e%p1%{14}%=%t6%e?\0" /* 2982 */
+"\033#P\0" /* 3203 */
+"\033#;\0" /* 3207 */
+"\033#<\0" /* 3211 */
+"\033#=\0" /* 3215 */
+"\033#>\0" /* 3219 */
+"\033#?\0" /* 3223 */
+"\033#@\0" /* 3227 */
+"\033#A\0" /* 3231 */
+"\033#B\0" /* 3235 */
+"\033#C\0" /* 3239 */
+"\033#G\0" /* 3243 */
+"\033#K\0" /* 3247 */
+"\033#M\0" /* 3251 */
+"\033#H\0" /* 3255 */
+"\033[8~\0" /* 3259 */
+"\033[7~\0" /* 3264 */
+;
+
+static const unsigned int terminfo_offsets[][TS_MAX] = {
+{1,9,26,33,46,51,56,74,79,84,91,217,225,347,233,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,492,469,460,485,478,},
+{1,9,0,0,0,51,524,74,79,533,537,217,225,0,0,550,556,562,568,156,162,168,174,180,126,132,138,190,109,0,0,204,199,213,114,195,209,0,0,0,0,0,},
+{1,9,26,33,46,51,56,74,79,84,91,217,225,638,574,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,492,469,460,485,478,},
+{701,706,0,0,0,0,0,0,0,0,0,0,0,0,0,734,737,740,0,743,747,751,755,759,0,0,0,0,0,0,0,0,0,769,731,763,766,0,0,0,0,0,},
+{1,9,0,0,0,772,524,780,788,533,537,217,225,0,0,550,556,562,568,156,162,168,174,180,126,132,138,190,109,0,0,204,199,213,114,195,209,0,0,0,0,0,},
+{1,9,26,796,46,51,803,74,79,820,825,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,0,0,0,0,0,},
+{1,9,26,33,46,51,56,74,79,84,91,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,492,469,460,485,478,},
+{1,9,26,796,0,51,524,74,79,820,537,217,225,852,842,550,556,562,568,156,162,168,174,180,126,132,138,190,862,186,118,204,199,213,114,195,209,0,0,0,0,0,},
+{1,9,26,33,46,51,56,74,79,84,91,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,864,469,460,485,478,},
+{1,9,26,33,46,51,56,74,79,84,91,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,891,469,460,485,478,},
+{1,9,26,796,46,51,928,74,79,820,937,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,0,0,0,0,0,},
+{1,9,26,33,46,51,56,74,79,84,91,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,492,0,0,0,0,},
+{1,9,26,33,46,51,0,74,79,84,0,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,492,469,460,485,478,},
+{956,962,978,984,995,999,1003,1011,1015,1019,1026,1130,1137,1153,1144,1045,1065,1070,1075,1080,1085,1090,1095,1100,1050,1055,1060,1109,1034,1105,1041,1120,1116,1127,1038,1113,1124,0,0,0,0,0,},
+{1,9,26,33,46,51,56,74,79,84,91,217,225,852,842,1170,1186,1190,1194,1198,1202,1206,1210,1214,1174,1178,1182,1222,862,1218,1166,1234,1230,1242,1162,1226,1238,492,0,0,0,0,},
+{1,9,26,33,46,51,928,74,79,820,937,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,0,0,0,0,0,},
+{1,9,26,33,46,51,56,74,79,84,91,217,225,852,842,1258,1286,1293,1300,1307,1314,1321,1328,1335,1265,1272,1279,1349,1246,1342,1251,1361,1354,213,114,195,209,492,0,0,0,0,},
+{1,9,26,796,0,51,524,74,79,820,537,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,862,186,118,204,199,213,114,195,209,0,0,0,0,0,},
+{1,9,0,0,0,51,1368,74,0,820,1385,0,0,0,0,122,144,148,152,1406,1410,1414,1418,1422,1398,1402,213,0,0,1218,1394,1174,1214,213,114,195,209,0,0,0,0,0,},
+{1,9,26,33,46,51,56,74,79,84,91,217,225,1510,1426,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,492,469,460,485,478,},
+{1,9,0,0,0,51,0,74,79,533,0,217,225,0,0,550,556,562,568,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,0,0,0,0,0,},
+{1,9,26,33,46,51,56,74,79,84,91,217,225,852,842,1597,1600,1603,1606,1609,1612,1615,1618,180,126,132,138,737,734,1621,1594,1627,1624,769,731,763,766,492,0,0,0,0,},
+{1,9,26,33,46,51,56,74,79,84,91,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,1630,469,460,485,478,},
+{1,9,26,33,46,51,56,74,79,84,91,217,225,1807,1667,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,492,469,460,485,478,},
+{1,9,26,33,46,51,56,74,79,84,91,217,225,1988,1946,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,492,469,460,485,478,},
+{1,9,0,0,0,51,1368,74,0,820,1385,0,0,852,842,122,144,148,152,1406,1410,1414,1418,1422,1398,1402,213,0,0,1218,1394,1174,1214,213,114,195,209,0,0,0,0,0,},
+{1,9,26,33,46,51,0,74,79,84,0,2030,2033,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,1218,1166,204,199,1242,1162,1226,1238,492,469,460,485,478,},
+{1,9,26,33,46,51,56,74,79,84,91,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,2036,469,460,485,478,},
+{1,9,26,33,46,51,2068,74,79,84,2078,217,225,2171,2088,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,492,469,460,485,478,},
+{1,9,0,0,0,51,524,74,79,533,537,217,225,852,842,550,556,562,568,156,162,168,174,180,126,132,138,190,109,0,0,204,199,213,114,195,209,0,0,0,0,0,},
+{1,9,0,0,0,51,524,74,51,533,537,217,225,0,0,550,556,562,568,156,162,168,174,180,126,132,138,190,109,0,0,204,199,213,114,195,209,0,0,0,0,0,},
+{1,9,26,33,46,51,56,74,79,84,91,217,225,852,842,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+{1,9,26,33,46,51,56,74,79,84,91,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,2254,469,460,485,478,},
+{1,9,26,796,46,51,524,74,79,2278,537,217,225,638,574,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,492,469,460,485,478,},
+{1,9,26,796,46,51,524,74,79,2278,537,217,225,852,842,550,556,562,568,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,492,469,460,485,478,},
+{1,9,26,796,46,51,524,74,79,2278,537,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,492,469,460,485,478,},
+{1,9,26,796,46,51,524,74,79,2278,537,217,225,852,842,0,0,0,0,0,0,0,0,0,0,0,0,190,109,951,946,204,199,213,114,195,209,492,469,460,485,478,},
+{1,9,26,796,46,51,524,74,79,2278,537,217,225,852,842,550,556,562,568,156,162,168,174,180,126,132,138,190,109,1218,1166,204,199,213,114,195,209,492,469,460,485,478,},
+{1,9,26,796,46,51,524,74,79,2278,537,217,225,852,842,2284,2289,2294,2299,2304,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,492,469,460,485,478,},
+{1,9,26,796,46,51,524,74,79,2278,537,217,225,852,842,550,556,562,568,156,162,168,174,180,126,132,138,190,862,1218,1166,204,199,213,114,195,209,492,469,460,485,478,},
+{1,9,26,796,46,51,524,74,79,2278,537,217,225,2392,2309,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,492,469,460,485,478,},
+{1,9,26,796,46,51,524,74,79,2278,537,217,225,1988,1946,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,492,469,460,485,478,},
+{2475,9,26,796,46,51,928,74,79,820,937,217,225,852,842,550,556,562,568,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,492,469,460,485,478,},
+{2475,9,26,796,46,51,928,74,79,820,937,217,225,852,842,1170,1186,1190,1194,1198,1202,1206,1210,1214,1174,1178,1182,1222,862,1218,1166,1234,1230,1242,1162,1226,1238,492,469,460,485,478,},
+{2475,9,26,2482,46,2494,524,74,79,2500,537,0,0,2507,2507,550,556,562,568,156,162,168,174,180,126,132,138,190,109,951,946,204,199,1242,1162,1226,1238,0,0,0,0,0,},
+{2475,9,26,796,46,51,524,74,79,533,537,0,0,852,842,550,556,562,568,156,162,168,174,180,126,132,138,190,109,951,946,204,199,1242,1162,1226,1238,0,0,0,0,0,},
+{2475,9,26,796,46,51,928,74,79,820,937,217,225,852,842,122,144,148,152,1406,1410,1414,1418,1422,1398,1402,2509,190,109,951,946,204,199,213,114,195,209,492,469,460,485,478,},
+{2475,9,26,796,46,51,928,74,79,820,937,217,225,638,574,550,556,562,568,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,492,469,460,485,478,},
+{2475,9,26,796,46,2494,524,74,79,533,537,0,0,2507,2507,550,556,562,568,156,162,168,174,180,126,132,138,190,109,951,946,204,199,1242,1162,1226,1238,0,0,0,0,0,},
+{2475,9,26,796,46,51,928,74,79,820,937,2030,2033,852,842,550,556,562,568,156,162,168,174,180,126,132,138,190,109,951,946,204,199,1242,1162,1226,1238,492,469,460,485,478,},
+{2475,9,2513,2525,46,51,0,74,79,820,0,0,0,2575,2537,2284,2289,2294,2299,2304,162,168,174,180,126,132,138,190,109,951,946,204,199,1242,1162,1226,1238,0,0,0,0,0,},
+{2475,9,2513,2525,46,51,0,74,79,820,0,0,0,852,842,2284,2289,2294,2299,2304,162,168,174,180,126,132,138,190,109,951,946,204,199,1242,1162,1226,1238,0,0,0,0,0,},
+{2613,9,2513,2525,46,51,0,74,79,820,0,0,0,852,842,2284,2289,2294,2299,2304,162,168,174,180,126,132,138,190,109,951,946,204,199,1242,1162,1226,1238,0,0,0,0,0,},
+{2475,9,2513,2525,46,51,0,74,79,2634,0,0,0,852,842,2284,2289,2294,2299,2304,162,168,174,180,126,132,138,190,109,951,946,204,199,1242,1162,1226,1238,0,0,0,0,0,},
+{2475,9,0,0,46,51,0,74,79,2643,0,0,0,852,842,2284,2289,2294,2299,2304,162,168,174,180,126,132,138,190,109,951,946,204,199,1242,1162,1226,1238,0,0,0,0,0,},
+{2475,9,2513,2525,46,51,0,74,79,820,0,0,0,0,0,2284,2289,2294,2299,2304,162,168,174,180,126,132,138,190,109,951,946,204,199,1242,1162,1226,1238,0,0,0,0,0,},
+{2475,9,2513,2525,46,51,0,74,79,2643,0,0,0,852,842,2284,2289,2294,2299,2304,162,168,174,180,126,132,138,190,109,951,946,204,199,1242,1162,1226,1238,0,0,0,0,0,},
+{2475,9,26,796,46,2494,0,74,0,533,0,0,0,2507,2507,2284,2289,2294,2299,2304,162,168,174,180,126,132,138,190,109,951,946,204,199,1242,1162,1226,1238,0,0,0,0,0,},
+{2475,9,26,2482,46,2494,0,74,0,2500,0,0,0,2507,2507,2284,2289,2294,2299,2304,162,168,174,180,126,132,138,190,109,951,946,204,199,1242,1162,1226,1238,0,0,0,0,0,},
+{2475,9,26,796,46,51,0,74,0,533,0,0,0,852,842,2284,2289,2294,2299,2304,162,168,174,180,126,132,138,190,109,951,946,204,199,1242,1162,1226,1238,0,0,0,0,0,},
+{1,9,26,796,0,51,524,74,79,2278,537,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,0,0,204,199,213,114,195,209,0,0,0,0,0,},
+{1,9,26,796,0,51,524,74,79,2278,537,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,0,0,0,0,0,},
+{1,9,0,0,0,51,524,74,79,533,537,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,862,0,0,204,199,213,114,195,209,0,0,0,0,0,},
+{1,9,26,796,0,51,524,74,79,2278,537,217,225,638,574,122,144,148,152,156,162,168,174,180,126,132,138,190,109,186,118,204,199,213,114,195,209,0,0,0,0,0,},
+{2475,9,26,2651,46,51,928,74,79,820,937,217,225,638,574,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,0,0,0,0,0,},
+{1,9,26,33,46,51,56,74,79,84,91,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,864,0,0,0,0,},
+{1,9,0,0,0,51,524,74,79,533,537,217,225,0,0,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,864,0,0,0,0,},
+{2475,9,26,2651,46,51,928,74,79,820,937,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,864,0,0,0,0,},
+{1,9,26,796,46,51,928,74,79,2663,937,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,0,469,460,485,478,},
+{1,9,26,796,46,51,524,74,79,820,537,2030,2033,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,1242,1162,1226,1238,864,0,0,0,0,},
+{2668,9,0,0,0,0,0,0,79,533,0,0,0,0,0,1624,1627,2676,2679,2682,734,737,740,2685,0,0,0,0,0,2689,0,0,0,769,731,763,766,0,0,0,0,0,},
+{2475,9,26,2651,46,51,928,74,79,820,937,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,0,0,0,0,0,},
+{1,9,26,796,46,51,56,74,79,2278,91,217,225,638,574,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,864,0,0,0,0,},
+{1,9,26,796,46,51,524,74,79,2278,537,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,864,0,0,0,0,},
+{2475,9,26,2651,46,51,928,74,79,820,937,217,225,0,0,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,864,0,0,0,0,},
+{2475,9,26,2651,46,51,928,74,79,820,937,217,225,1988,1946,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,0,0,0,0,0,},
+{1,9,26,796,46,51,928,74,79,2663,937,217,225,1988,1946,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,0,469,460,485,478,},
+{2475,9,26,2651,46,0,928,74,0,820,937,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,864,0,0,0,0,},
+{2475,9,26,2651,46,51,928,74,0,820,937,217,225,0,0,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,864,0,0,0,0,},
+{2692,706,2695,2698,1603,2704,2708,1597,2716,2720,2724,0,0,0,0,734,737,740,1624,1627,2676,2679,2682,2738,2735,1597,1600,2741,862,2692,0,2747,2744,769,731,763,766,0,0,0,0,0,},
+{1,9,26,796,46,51,928,74,79,2663,937,217,225,638,574,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,0,469,460,485,478,},
+{1,9,26,796,46,51,524,74,79,820,537,2750,2750,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,1242,1162,1226,1238,864,0,0,0,0,},
+{1,9,26,796,46,51,524,74,79,2278,537,217,225,638,574,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,864,0,0,0,0,},
+{1,9,26,796,0,51,524,74,79,2278,537,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,864,0,0,0,0,},
+{1,9,26,796,46,51,56,74,79,2751,91,217,225,638,574,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,864,0,0,0,0,},
+{2692,706,2695,2758,0,0,0,1597,0,1600,0,0,0,0,0,734,737,740,1624,1627,2676,2679,2682,2738,2735,1597,1600,2741,862,2692,0,2747,2744,769,731,763,766,0,0,0,0,0,},
+{2475,9,26,796,46,51,928,74,79,820,937,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,864,0,0,0,0,},
+{2692,706,2695,2758,0,0,0,1597,0,1600,0,0,0,2982,2761,734,737,740,1624,1627,2676,2679,2682,2738,2735,1597,1600,2741,862,2692,0,2747,2744,769,731,763,766,0,0,0,0,0,},
+{1,9,26,796,46,51,928,74,79,2663,937,217,225,2392,2309,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,0,469,460,485,478,},
+{2475,9,26,796,46,51,928,74,79,820,937,217,225,638,574,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,864,0,0,0,0,},
+{1,9,26,796,46,51,56,74,79,2751,91,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,864,0,0,0,0,},
+{1,9,26,33,46,51,56,74,79,84,91,217,225,638,574,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,864,0,0,0,0,},
+{1,9,26,796,46,51,56,74,79,2278,91,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,864,0,0,0,0,},
+{701,706,2695,2758,0,0,2758,0,0,1600,2750,0,0,0,0,3207,3211,3215,3219,3223,3227,3231,3235,3239,0,0,0,0,0,3243,0,0,0,3255,3203,3247,3251,0,0,0,0,0,},
+{2475,9,26,2651,46,51,928,74,0,820,937,217,225,852,842,122,144,148,152,156,162,168,174,180,126,132,138,190,109,951,946,204,199,213,114,195,209,864,0,0,0,0,},
+{2475,9,0,0,46,51,0,74,79,533,0,2030,2033,0,0,122,144,148,152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,213,114,195,209,0,0,0,0,0,},
+{1,9,26,796,46,51,524,74,79,820,537,2030,2033,852,842,550,556,562,568,156,162,168,174,180,126,132,138,190,109,3264,3259,204,199,1242,1162,1226,1238,0,0,0,0,0,},
+{1,9,26,796,46,51,524,74,79,2278,537,2030,2033,0,0,550,556,562,568,156,162,168,174,180,126,132,138,190,109,3264,3259,204,199,1242,1162,1226,1238,0,0,0,0,0,},
+{1,9,26,796,46,51,524,74,79,820,537,2030,2033,1988,1946,550,556,562,568,156,162,168,174,180,126,132,138,190,109,3264,3259,204,199,1242,1162,1226,1238,0,0,0,0,0,},
+{1,9,26,796,46,51,524,74,79,820,537,2030,2033,638,574,550,556,562,568,156,162,168,174,180,126,132,138,190,109,3264,3259,204,199,1242,1162,1226,1238,0,0,0,0,0,},
+};
+
+static const unsigned short terminfo_lengths[][TS_MAX] = {
+{7,16,6,12,4,4,17,4,4,6,17,7,7,112,113,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,31,8,8,6,6,},
+{7,16,0,0,0,4,8,4,4,3,12,7,7,0,0,5,5,5,5,5,5,5,5,5,5,5,5,4,4,0,0,4,4,3,3,3,3,0,0,0,0,0,},
+{7,16,6,12,4,4,17,4,4,6,17,7,7,62,63,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,31,8,8,6,6,},
+{4,24,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,0,3,3,3,3,3,0,0,0,0,0,0,0,0,0,2,2,2,2,0,0,0,0,0,},
+{7,16,0,0,0,7,8,7,7,3,12,7,7,0,0,5,5,5,5,5,5,5,5,5,5,5,5,4,4,0,0,4,4,3,3,3,3,0,0,0,0,0,},
+{7,16,6,6,4,4,16,4,4,4,16,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,0,0,0,0,0,},
+{7,16,6,12,4,4,17,4,4,6,17,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,31,8,8,6,6,},
+{7,16,6,6,0,4,8,4,4,4,12,7,7,9,9,5,5,5,5,5,5,5,5,5,5,5,5,4,1,3,3,4,4,3,3,3,3,0,0,0,0,0,},
+{7,16,6,12,4,4,17,4,4,6,17,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,26,8,8,6,6,},
+{7,16,6,12,4,4,17,4,4,6,17,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,36,8,8,6,6,},
+{7,16,6,6,4,4,8,4,4,4,8,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,0,0,0,0,0,},
+{7,16,6,12,4,4,17,4,4,6,17,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,31,0,0,0,0,},
+{7,16,6,12,4,4,0,4,4,6,0,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,31,8,8,6,6,},
+{5,15,5,10,3,3,7,3,3,6,7,6,6,8,8,4,4,4,4,4,4,4,4,4,4,4,4,3,3,3,3,3,3,2,2,2,2,0,0,0,0,0,},
+{7,16,6,12,4,4,17,4,4,6,17,7,7,9,9,3,3,3,3,3,3,3,3,3,3,3,3,3,1,3,3,3,3,3,3,3,3,31,0,0,0,0,},
+{7,16,6,12,4,4,8,4,4,4,8,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,0,0,0,0,0,},
+{7,16,6,12,4,4,17,4,4,6,17,7,7,9,9,6,6,6,6,6,6,6,6,6,6,6,6,4,4,6,6,6,6,3,3,3,3,31,0,0,0,0,},
+{7,16,6,6,0,4,8,4,4,4,12,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,1,3,3,4,4,3,3,3,3,0,0,0,0,0,},
+{7,16,0,0,0,4,16,4,0,4,8,0,0,0,0,3,3,3,3,3,3,3,3,3,3,3,3,0,0,3,3,3,3,3,3,3,3,0,0,0,0,0,},
+{7,16,6,12,4,4,17,4,4,6,17,7,7,83,83,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,31,8,8,6,6,},
+{7,16,0,0,0,4,0,4,4,3,0,7,7,0,0,5,5,5,5,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+{7,16,6,12,4,4,17,4,4,6,17,7,7,9,9,2,2,2,2,2,2,2,2,5,5,5,5,2,2,2,2,2,2,2,2,2,2,31,0,0,0,0,},
+{7,16,6,12,4,4,17,4,4,6,17,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,36,8,8,6,6,},
+{7,16,6,12,4,4,17,4,4,6,17,7,7,138,139,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,31,8,8,6,6,},
+{7,16,6,12,4,4,17,4,4,6,17,7,7,41,41,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,31,8,8,6,6,},
+{7,16,0,0,0,4,16,4,0,4,8,0,0,9,9,3,3,3,3,3,3,3,3,3,3,3,3,0,0,3,3,3,3,3,3,3,3,0,0,0,0,0,},
+{7,16,6,12,4,4,0,4,4,6,0,2,2,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,31,8,8,6,6,},
+{7,16,6,12,4,4,17,4,4,6,17,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,31,8,8,6,6,},
+{7,16,6,12,4,4,9,4,4,6,9,7,7,82,82,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,31,8,8,6,6,},
+{7,16,0,0,0,4,8,4,4,3,12,7,7,9,9,5,5,5,5,5,5,5,5,5,5,5,5,4,4,0,0,4,4,3,3,3,3,0,0,0,0,0,},
+{7,16,0,0,0,4,8,4,4,3,12,7,7,0,0,5,5,5,5,5,5,5,5,5,5,5,5,4,4,0,0,4,4,3,3,3,3,0,0,0,0,0,},
+{7,16,6,12,4,4,17,4,4,6,17,7,7,9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+{7,16,6,12,4,4,17,4,4,6,17,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,23,8,8,6,6,},
+{7,16,6,6,4,4,8,4,4,5,12,7,7,62,63,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,31,8,8,6,6,},
+{7,16,6,6,4,4,8,4,4,5,12,7,7,9,9,5,5,5,5,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,31,8,8,6,6,},
+{7,16,6,6,4,4,8,4,4,5,12,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,31,8,8,6,6,},
+{7,16,6,6,4,4,8,4,4,5,12,7,7,9,9,0,0,0,0,0,0,0,0,0,0,0,0,4,4,4,4,4,4,3,3,3,3,31,8,8,6,6,},
+{7,16,6,6,4,4,8,4,4,5,12,7,7,9,9,5,5,5,5,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,31,8,8,6,6,},
+{7,16,6,6,4,4,8,4,4,5,12,7,7,9,9,4,4,4,4,4,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,31,8,8,6,6,},
+{7,16,6,6,4,4,8,4,4,5,12,7,7,9,9,5,5,5,5,5,5,5,5,5,5,5,5,4,1,3,3,4,4,3,3,3,3,31,8,8,6,6,},
+{7,16,6,6,4,4,8,4,4,5,12,7,7,82,82,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,31,8,8,6,6,},
+{7,16,6,6,4,4,8,4,4,5,12,7,7,41,41,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,31,8,8,6,6,},
+{6,16,6,6,4,4,8,4,4,4,8,7,7,9,9,5,5,5,5,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,31,8,8,6,6,},
+{6,16,6,6,4,4,8,4,4,4,8,7,7,9,9,3,3,3,3,3,3,3,3,3,3,3,3,3,1,3,3,3,3,3,3,3,3,31,8,8,6,6,},
+{6,16,6,11,4,5,8,4,4,6,12,0,0,1,1,5,5,5,5,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+{6,16,6,6,4,4,8,4,4,3,12,0,0,9,9,5,5,5,5,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+{6,16,6,6,4,4,8,4,4,4,8,7,7,9,9,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,3,3,3,3,31,8,8,6,6,},
+{6,16,6,6,4,4,8,4,4,4,8,7,7,62,63,5,5,5,5,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,31,8,8,6,6,},
+{6,16,6,6,4,5,8,4,4,3,12,0,0,1,1,5,5,5,5,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+{6,16,6,6,4,4,8,4,4,4,8,2,2,9,9,5,5,5,5,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,31,8,8,6,6,},
+{6,16,11,11,4,4,0,4,4,4,0,0,0,37,37,4,4,4,4,4,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+{6,16,11,11,4,4,0,4,4,4,0,0,0,9,9,4,4,4,4,4,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+{20,16,11,11,4,4,0,4,4,4,0,0,0,9,9,4,4,4,4,4,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+{6,16,11,11,4,4,0,4,4,8,0,0,0,9,9,4,4,4,4,4,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+{6,16,0,0,4,4,0,4,4,7,0,0,0,9,9,4,4,4,4,4,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+{6,16,11,11,4,4,0,4,4,4,0,0,0,0,0,4,4,4,4,4,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+{6,16,11,11,4,4,0,4,4,7,0,0,0,9,9,4,4,4,4,4,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+{6,16,6,6,4,5,0,4,0,3,0,0,0,1,1,4,4,4,4,4,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+{6,16,6,11,4,5,0,4,0,6,0,0,0,1,1,4,4,4,4,4,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+{6,16,6,6,4,4,0,4,0,3,0,0,0,9,9,4,4,4,4,4,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+{7,16,6,6,0,4,8,4,4,5,12,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,0,0,4,4,3,3,3,3,0,0,0,0,0,},
+{7,16,6,6,0,4,8,4,4,5,12,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,0,0,0,0,0,},
+{7,16,0,0,0,4,8,4,4,3,12,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,1,0,0,4,4,3,3,3,3,0,0,0,0,0,},
+{7,16,6,6,0,4,8,4,4,5,12,7,7,62,63,3,3,3,3,5,5,5,5,5,5,5,5,4,4,3,3,4,4,3,3,3,3,0,0,0,0,0,},
+{6,16,6,11,4,4,8,4,4,4,8,7,7,62,63,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+{7,16,6,12,4,4,17,4,4,6,17,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,26,0,0,0,0,},
+{7,16,0,0,0,4,8,4,4,3,12,7,7,0,0,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,26,0,0,0,0,},
+{6,16,6,11,4,4,8,4,4,4,8,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,26,0,0,0,0,},
+{7,16,6,6,4,4,8,4,4,4,8,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,8,8,6,6,},
+{7,16,6,6,4,4,8,4,4,4,12,2,2,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,26,0,0,0,0,},
+{7,16,0,0,0,0,0,0,4,3,0,0,0,0,0,2,2,2,2,2,2,2,2,3,0,0,0,0,0,2,0,0,0,2,2,2,2,0,0,0,0,0,},
+{6,16,6,11,4,4,8,4,4,4,8,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+{7,16,6,6,4,4,17,4,4,5,17,7,7,62,63,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,26,0,0,0,0,},
+{7,16,6,6,4,4,8,4,4,5,12,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,26,0,0,0,0,},
+{6,16,6,11,4,4,8,4,4,4,8,7,7,0,0,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,26,0,0,0,0,},
+{6,16,6,11,4,4,8,4,4,4,8,7,7,41,41,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+{7,16,6,6,4,4,8,4,4,4,8,7,7,41,41,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,8,8,6,6,},
+{6,16,6,11,4,0,8,4,0,4,8,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,26,0,0,0,0,},
+{6,16,6,11,4,4,8,4,0,4,8,7,7,0,0,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,26,0,0,0,0,},
+{2,24,2,5,2,3,7,2,3,3,10,0,0,0,0,2,2,2,2,2,2,2,2,2,2,2,2,2,1,2,0,2,2,2,2,2,2,0,0,0,0,0,},
+{7,16,6,6,4,4,8,4,4,4,8,7,7,62,63,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,8,8,6,6,},
+{7,16,6,6,4,4,8,4,4,4,12,0,0,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,26,0,0,0,0,},
+{7,16,6,6,4,4,8,4,4,5,12,7,7,62,63,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,26,0,0,0,0,},
+{7,16,6,6,0,4,8,4,4,5,12,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,26,0,0,0,0,},
+{7,16,6,6,4,4,17,4,4,6,17,7,7,62,63,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,26,0,0,0,0,},
+{2,24,2,2,0,0,0,2,0,2,0,0,0,0,0,2,2,2,2,2,2,2,2,2,2,2,2,2,1,2,0,2,2,2,2,2,2,0,0,0,0,0,},
+{6,16,6,6,4,4,8,4,4,4,8,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,26,0,0,0,0,},
+{2,24,2,2,0,0,0,2,0,2,0,0,0,220,220,2,2,2,2,2,2,2,2,2,2,2,2,2,1,2,0,2,2,2,2,2,2,0,0,0,0,0,},
+{7,16,6,6,4,4,8,4,4,4,8,7,7,82,82,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,8,8,6,6,},
+{6,16,6,6,4,4,8,4,4,4,8,7,7,62,63,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,26,0,0,0,0,},
+{7,16,6,6,4,4,17,4,4,6,17,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,26,0,0,0,0,},
+{7,16,6,12,4,4,17,4,4,6,17,7,7,62,63,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,26,0,0,0,0,},
+{7,16,6,6,4,4,17,4,4,5,17,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,26,0,0,0,0,},
+{4,24,2,2,0,0,2,0,0,2,0,0,0,0,0,3,3,3,3,3,3,3,3,3,0,0,0,0,0,3,0,0,0,3,3,3,3,0,0,0,0,0,},
+{6,16,6,11,4,4,8,4,0,4,8,7,7,9,9,3,3,3,3,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,26,0,0,0,0,},
+{6,16,0,0,4,4,0,4,4,3,0,2,2,0,0,3,3,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,3,3,3,0,0,0,0,0,},
+{7,16,6,6,4,4,8,4,4,4,12,2,2,9,9,5,5,5,5,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+{7,16,6,6,4,4,8,4,4,5,12,2,2,0,0,5,5,5,5,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+{7,16,6,6,4,4,8,4,4,4,12,2,2,41,41,5,5,5,5,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+{7,16,6,6,4,4,8,4,4,4,12,2,2,62,63,5,5,5,5,5,5,5,5,5,5,5,5,4,4,4,4,4,4,3,3,3,3,0,0,0,0,0,},
+};
+
+typedef struct {
+	const char *name;
+	unsigned short esc;
+	unsigned int caps;
+	unsigned char caps_;
+	short capsn[TN_MAX];
+} terminal_map;
+
+#define TERMINAL_COUNT 169
+#define TERMINAL_BUCKETS 85
+
+static const unsigned short terminal_displacement[] = {
+3,1,0,2,0,7,1,11,4,1,13,0,26,36,1,19,2,9,2,11,1,2,8,8,17,0,8,1,21,3,1,5,12,11,5,0,0,1,2,27,21,11,19,4,3,12,6,16,0,32,15,12,37,6,8,0,1,41,7,15,0,0,7,8,48,55,7,15,24,29,0,0,1,6,31,24,71,0,3,0,0,32,109,21,63
+};
+
+static const terminal_map terminals[] = {
+{"screen.linux-m2",78,49700u,0,{0,80,8,24,0,40,0,0x100,}}, /* 0 */
+{"xterm-sun",16,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 1 */
+{"screen-256color-bce-s",64,536920612u,0,{0,80,8,24,0,40,0,0x100,}}, /* 2 */
+{"xterm-r6",1,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 3 */
+{"xtermm",18,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 4 */
+{"screen.minitel1",77,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 5 */
+{"linux-c-nc",54,807452772u,0,{0,80,8,24,0,40,0,8,}}, /* 6 */
+{"konsole",35,604028964u,0,{0,80,8,24,0,40,0,8,}}, /* 7 */
+{"screen-bce.linux",67,536920614u,0,{0,80,8,24,0,40,0,8,}}, /* 8 */
+{"xterm-direct256",23,612418084u,0,{0,80,8,24,0,40,0,0x1000000,}}, /* 9 */
+{"putty",42,807453734u,0,{0,80,8,24,0,40,0,8,}}, /* 10 */
+{"st-16color",76,604029988u,0,{0,80,8,24,0,40,0,16,}}, /* 11 */
+{"screen-16color-bce",75,536920612u,0,{0,80,8,24,0,40,0,16,}}, /* 12 */
+{"screen3",95,49664u,0,{0,80,8,24,0,40,0,8,}}, /* 13 */
+{"screen-bce",71,536920612u,0,{0,80,8,24,0,40,0,8,}}, /* 14 */
+{"screen.Eterm",81,547405926u,0,{0,80,8,24,0,40,0,8,}}, /* 15 */
+{"putty-m1b",48,50212u,0,{0,80,8,24,0,40,0,0x100,}}, /* 16 */
+{"konsole-xf4x",35,604028964u,0,{0,80,8,24,0,40,0,8,}}, /* 17 */
+{"screen-256color",64,49700u,0,{0,80,8,24,0,40,0,0x100,}}, /* 18 */
+{"xterm-24",1,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 19 */
+{"xterm-xf86-v33",17,536920612u,0,{0,80,8,24,0,40,0,8,}}, /* 20 */
+{"xterm-xi",17,536920612u,0,{0,80,8,24,0,40,0,8,}}, /* 21 */
+{"xterm-direct2",28,612418084u,0,{0,80,8,24,0,40,0,0x1000000,}}, /* 22 */
+{"xterm-p370",6,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 23 */
+{"putty-sco",43,807453734u,0,{0,80,8,24,0,40,0,8,}}, /* 24 */
+{"gnome",61,536920100u,0,{0,80,8,24,0,40,0,8,}}, /* 25 */
+{"linux2.6.26",51,270581860u,0,{0,80,8,24,0,40,0,8,}}, /* 26 */
+{"st-0.7",68,872465444u,0,{0,80,8,24,0,40,0,8,}}, /* 27 */
+{"linux-16color",50,807452772u,0,{0,80,8,24,0,40,0,16,}}, /* 28 */
+{"gnome-rh72",60,536920100u,0,{0,80,8,24,0,40,0,8,}}, /* 29 */
+{"xterm-vt52",3,0u,0,{0,80,8,24,0,0,0,88,}}, /* 30 */
+{"screen.mlterm",90,612549156u,0,{0,80,8,24,0,40,0,8,}}, /* 31 */
+{"linux-nic",51,807452772u,0,{0,80,8,24,0,40,0,8,}}, /* 32 */
+{"konsole-linux",38,604028964u,0,{0,80,8,24,0,40,0,8,}}, /* 33 */
+{"linux2.2",56,807452772u,0,{0,80,8,24,0,40,0,8,}}, /* 34 */
+{"screen-16color",75,49700u,0,{0,80,8,24,0,40,0,16,}}, /* 35 */
+{"konsole-xf3x",34,604028964u,0,{0,80,8,24,0,40,0,8,}}, /* 36 */
+{"xterm",6,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 37 */
+{"st",68,604029988u,0,{0,80,8,24,0,40,0,8,}}, /* 38 */
+{"xterm-x11mouse",8,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 39 */
+{"gnome-rh62",62,536920612u,0,{0,80,8,24,0,40,0,8,}}, /* 40 */
+{"xterms-sun",16,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 41 */
+{"st-256color",80,872465444u,0,{0,80,8,24,0,40,0,0x100,}}, /* 42 */
+{"xterm-1003",9,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 43 */
+{"konsole-vt100",37,604028964u,0,{0,80,8,24,0,40,0,8,}}, /* 44 */
+{"xterm-xf86-v44",15,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 45 */
+{"screen.minitel1b-80",74,49700u,0,{0,80,8,24,0,40,0,0x100,}}, /* 46 */
+{"rxvt-256color",99,807452772u,0,{0,80,8,24,0,40,0,0x100,}}, /* 47 */
+{"screen.minitel1b-nb",78,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 48 */
+{"screen-bce.Eterm",81,547405926u,0,{0,80,8,24,0,40,0,8,}}, /* 49 */
+{"xterm-16color",24,880853540u,0,{0,80,8,24,0,40,0,16,}}, /* 50 */
+{"xterm-xfree86",15,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 51 */
+{"linux-m1b",57,49188u,0,{0,80,8,24,0,40,0,8,}}, /* 52 */
+{"xtermc",25,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 53 */
+{"stv52",79,32772u,0,{0,80,8,30,0,40,0,0x100,}}, /* 54 */
+{"screen.linux-m1",94,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 55 */
+{"rxvt-88color",99,807452772u,0,{0,80,8,24,0,40,0,88,}}, /* 56 */
+{"screen-bce.rxvt",67,536920614u,0,{0,80,8,24,0,40,0,8,}}, /* 57 */
+{"xterm-x10mouse",32,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 58 */
+{"konsole-vt420pc",39,604028964u,0,{0,80,8,24,0,40,0,8,}}, /* 59 */
+{"linux-m2",58,49188u,0,{0,80,8,24,0,40,0,8,}}, /* 60 */
+{"screen.linux",67,49702u,0,{0,80,8,24,0,40,0,8,}}, /* 61 */
+{"putty-screen",42,807453734u,0,{0,80,8,24,0,40,0,8,}}, /* 62 */
+{"konsole-256color",33,604028964u,0,{0,80,8,24,0,40,0,0x100,}}, /* 63 */
+{"screen-16color-bce-s",75,536920612u,0,{0,80,8,24,0,40,0,16,}}, /* 64 */
+{"xterm-color",29,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 65 */
+{"screen-w",71,49700u,0,{0,132,8,24,0,40,0,8,}}, /* 66 */
+{"linux",51,807452772u,0,{0,80,8,24,0,40,0,8,}}, /* 67 */
+{"xterm-new",6,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 68 */
+{"xterm-hp",21,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 69 */
+{"screen.putty-256color",89,539018278u,0,{0,80,8,24,0,40,0,0x100,}}, /* 70 */
+{"putty-m1",45,268485668u,0,{0,80,8,24,0,40,0,8,}}, /* 71 */
+{"screen.mlterm-256color",84,612549156u,0,{0,80,8,24,0,40,0,0x100,}}, /* 72 */
+{"screen.konsole",73,604028964u,0,{0,80,8,24,0,40,0,8,}}, /* 73 */
+{"xterm-xf86-v32",7,536920612u,0,{0,80,8,24,0,40,0,8,}}, /* 74 */
+{"screen-s",71,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 75 */
+{"xterm-p371",6,612550180u,0,{0,80,8,24,0,40,0,8,}}, /* 76 */
+{"gnome-2012",61,536920100u,0,{0,80,8,24,0,40,0,8,}}, /* 77 */
+{"screen-bce.konsole",73,604028964u,0,{0,80,8,24,0,40,0,8,}}, /* 78 */
+{"screen.rxvt",67,49702u,0,{0,80,8,24,0,40,0,8,}}, /* 79 */
+{"rxvt-16color",98,539017316u,0,{0,80,8,24,0,40,0,16,}}, /* 80 */
+{"xterm-1002",22,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 81 */
+{"screen.putty",86,807453734u,0,{0,80,8,24,0,40,0,8,}}, /* 82 */
+{"konsole-16color",41,604028964u,0,{0,80,8,24,0,40,0,16,}}, /* 83 */
+{"screen-256color-bce",64,536920612u,0,{0,80,8,24,0,40,0,0x100,}}, /* 84 */
+{"screen-256color-s",64,49700u,0,{0,80,8,24,0,40,0,0x100,}}, /* 85 */
+{"screen.minitel1-nb",78,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 86 */
+{"xterm-1006",6,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 87 */
+{"screen.putty-m1b",74,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 88 */
+{"linux-vt",53,807452772u,0,{0,80,8,24,0,40,0,8,}}, /* 89 */
+{"screen.linux-m1b",78,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 90 */
+{"screen-16color-s",75,49700u,0,{0,80,8,24,0,40,0,16,}}, /* 91 */
+{"rxvt",96,539017316u,0,{0,80,8,24,0,40,0,8,}}, /* 92 */
+{"stv52pc",79,32772u,0,{0,80,8,30,0,40,0,8,}}, /* 93 */
+{"xterm-xf86-v43",10,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 94 */
+{"xterm-r5",20,33316u,0,{0,80,8,24,0,40,0,8,}}, /* 95 */
+{"screen.putty-m2",74,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 96 */
+{"screen",71,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 97 */
+{"screen4",71,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 98 */
+{"xterm-1005",27,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 99 */
+{"gnome-2008",61,536920100u,0,{0,80,8,24,0,40,0,8,}}, /* 100 */
+{"xterm1",12,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 101 */
+{"xterm-sco",14,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 102 */
+{"st-0.6",68,604029988u,0,{0,80,8,24,0,40,0,8,}}, /* 103 */
+{"rxvt-cygwin-native",96,539017316u,0,{0,80,8,24,0,40,0,8,}}, /* 104 */
+{"screen.vte",92,536920100u,0,{0,80,8,24,0,40,0,8,}}, /* 105 */
+{"gnome-rh80",60,16420u,0,{0,80,8,24,0,40,0,8,}}, /* 106 */
+{"st52",85,67125316u,0,{0,80,8,24,0,40,0,8,}}, /* 107 */
+{"linux3.0",51,807452772u,0,{0,80,8,24,0,40,0,8,}}, /* 108 */
+{"linux-lat",51,807452772u,0,{0,80,8,24,0,40,0,8,}}, /* 109 */
+{"rxvt-cygwin",96,539017316u,0,{0,80,8,24,0,40,0,8,}}, /* 110 */
+{"screen.vte-256color",72,536920100u,0,{0,80,8,24,0,40,0,0x100,}}, /* 111 */
+{"st-0.8",68,604029988u,0,{0,80,8,24,0,40,0,8,}}, /* 112 */
+{"putty-m2",44,50212u,0,{0,80,8,24,0,40,0,8,}}, /* 113 */
+{"xterm-256color",2,880853540u,0,{0,80,8,24,0,40,0,0x100,}}, /* 114 */
+{"st-direct",88,604029988u,0,{0,80,8,24,0,40,0,0x1000000,}}, /* 115 */
+{"konsole-base",36,604028964u,0,{0,80,8,24,0,40,0,8,}}, /* 116 */
+{"xterm-old",1,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 117 */
+{"xterm-noapp",26,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 118 */
+{"screen.xterm-256color",91,75547174u,0,{0,80,8,24,0,40,0,0x100,}}, /* 119 */
+{"linux-m1",59,268484644u,0,{0,80,8,24,0,40,0,8,}}, /* 120 */
+{"putty-vt100",46,807453734u,0,{0,80,8,24,0,40,0,8,}}, /* 121 */
+{"xterm-88color",2,880853540u,0,{0,80,8,24,0,0,0,88,}}, /* 122 */
+{"st52-color",87,603996228u,0,{0,80,8,24,0,40,0,16,}}, /* 123 */
+{"putty-noapp",49,807453734u,0,{0,80,8,24,0,40,0,8,}}, /* 124 */
+{"screen.konsole-256color",82,604028964u,0,{0,80,8,24,0,40,0,0x100,}}, /* 125 */
+{"gnome-rh90",61,536920100u,0,{0,80,8,24,0,40,0,8,}}, /* 126 */
+{"xterm-basic",31,545309220u,0,{0,80,8,24,0,40,0,8,}}, /* 127 */
+{"gnome-fc5",61,536920100u,0,{0,80,8,24,0,40,0,8,}}, /* 128 */
+{"screen.putty-m1",67,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 129 */
+{"linux-basic",54,539017316u,0,{0,80,8,24,0,40,0,8,}}, /* 130 */
+{"screen.xterm-r6",66,49702u,0,{0,80,8,24,0,40,0,8,}}, /* 131 */
+{"konsole-solaris",34,604028964u,0,{0,80,8,24,0,40,0,8,}}, /* 132 */
+{"xterm-utf8",6,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 133 */
+{"xterm-vt220",11,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 134 */
+{"rxvt-basic",97,539017316u,0,{0,80,8,24,0,40,0,8,}}, /* 135 */
+{"linux-koi8r",51,807452772u,0,{0,80,8,24,0,40,0,8,}}, /* 136 */
+{"xterm-x11hilite",8,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 137 */
+{"screen2",70,0u,0,{0,80,8,24,0,40,0,8,}}, /* 138 */
+{"screen-bce.gnome",83,536920100u,0,{0,80,8,24,0,40,0,8,}}, /* 139 */
+{"linux2.6",51,807452772u,0,{0,80,8,24,0,40,0,8,}}, /* 140 */
+{"screen5",71,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 141 */
+{"linux-m",55,807452772u,0,{0,80,8,24,0,40,0,8,}}, /* 142 */
+{"rxvt-xpm",96,539017316u,0,{0,80,8,24,0,40,0,8,}}, /* 143 */
+{"xterm-8bit",13,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 144 */
+{"konsole-direct",40,604028964u,0,{0,80,8,24,0,40,0,0x1000000,}}, /* 145 */
+{"screen-bce.xterm-new",65,612418086u,0,{0,80,8,24,0,40,0,8,}}, /* 146 */
+{"xterm-direct",19,612418084u,0,{0,80,8,24,0,40,0,0x1000000,}}, /* 147 */
+{"xterm-xf86-v40",10,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 148 */
+{"xterm-xf86-v333",5,545309220u,0,{0,80,8,24,0,40,0,8,}}, /* 149 */
+{"linux-koi8",51,807452772u,0,{0,80,8,24,0,40,0,8,}}, /* 150 */
+{"screen.xterm-xfree86",65,75547174u,0,{0,80,8,24,0,40,0,8,}}, /* 151 */
+{"gnome-2007",61,536920100u,0,{0,80,8,24,0,40,0,8,}}, /* 152 */
+{"linux-c",54,807452772u,0,{0,80,8,24,0,40,0,8,}}, /* 153 */
+{"putty-256color",47,539018278u,0,{0,80,8,24,0,40,0,0x100,}}, /* 154 */
+{"st52-old",93,516u,0,{0,80,8,25,0,40,0,8,}}, /* 155 */
+{"screen.teraterm",67,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 156 */
+{"screen.minitel1b",77,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 157 */
+{"screen.gnome",83,536920100u,0,{0,80,8,24,0,40,0,8,}}, /* 158 */
+{"xterm-nic",6,612418084u,0,{0,80,8,24,0,40,0,8,}}, /* 159 */
+{"xterm-pcolor",4,50724u,0,{0,80,8,24,0,40,0,88,}}, /* 160 */
+{"screen-bce.mrxvt",69,539017316u,0,{0,80,8,24,0,40,0,8,}}, /* 161 */
+{"screen.mrxvt",69,539017316u,0,{0,80,8,24,0,40,0,8,}}, /* 162 */
+{"gnome-256color",63,805355556u,0,{0,80,8,24,0,40,0,0x100,}}, /* 163 */
+{"xterm-bold",30,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 164 */
+{"screen-base",71,49700u,0,{0,80,8,24,0,40,0,8,}}, /* 165 */
+{"xterm-mono",1,49700u,0,{0,80,8,24,0,0,0,0x1000000,}}, /* 166 */
+{"xterm-direct16",0,612418084u,0,{0,80,8,24,0,0,0,0x1000000,}}, /* 167 */
+{"linux-s",52,807453796u,0,{0,80,8,24,0,40,0,8,}} /* 168 */
+};
+
+#endif